@@ -0,0 +1,406 @@
+/**
+ * @file BasicSequenceGenerator.h
+ * @brief Declaração do template BasicSequenceGenerator - gerador especializado para alfabetos fixos
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef BASIC_SEQUENCE_GENERATOR_H
+#define BASIC_SEQUENCE_GENERATOR_H
+
+#include "CounterRng.h"
+#include "RandomEngines.h"
+#include "SequenceGenerator.h"
+#include <vector>
+#include <string>
+#include <cstring>
+#include <stdexcept>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @struct CharAlphabet
+ * @brief Alfabeto de símbolos de um caractere conhecido em tempo de compilação
+ * @tparam Symbols Caracteres do alfabeto, na ordem dos identificadores
+ */
+template <char... Symbols>
+struct CharAlphabet {
+    static constexpr size_t size = sizeof...(Symbols);       ///< Número de símbolos
+    static constexpr char symbols[sizeof...(Symbols)] = {Symbols...};  ///< Tabela de símbolos
+
+    /**
+     * @brief Obtém o símbolo de um identificador
+     * @param id Identificador (deve ser menor que size)
+     * @return Caractere do símbolo
+     */
+    static constexpr char symbolAt(size_t id) {
+        return symbols[id];
+    }
+};
+
+template <char... Symbols>
+constexpr size_t CharAlphabet<Symbols...>::size;
+
+template <char... Symbols>
+constexpr char CharAlphabet<Symbols...>::symbols[sizeof...(Symbols)];
+
+/// Alfabeto padrão do jogo: {"A", "B", "C", "D"}
+typedef CharAlphabet<'A', 'B', 'C', 'D'> AlphabetABCD;
+
+/**
+ * @brief Calcula floor(log2(n)) em tempo de compilação
+ * @param n Valor positivo
+ * @return Logaritmo na base 2 arredondado para baixo
+ */
+constexpr unsigned alphabetLog2(size_t n) {
+    return n <= 1 ? 0 : 1 + alphabetLog2(n >> 1);
+}
+
+/**
+ * @class BasicSequenceGenerator
+ * @brief Gerador de sequências com alfabeto fixo em tempo de compilação
+ *
+ * O tamanho e a tabela de símbolos são constexpr: para alfabetos com tamanho
+ * potência de 2 a redução do número aleatório é um simples deslocamento, a
+ * busca de símbolos é resolvida sobre a tabela constante e a validação
+ * compara 8 elementos por iteração.
+ *
+ * O motor de números aleatórios é uma política (ver RandomEngines.h). Com o
+ * padrão PhiloxEngine o elemento i é função pura de (semente, sessão, i) e
+ * idêntico ao de um SequenceGenerator com o mesmo alfabeto, que continua
+ * disponível para alfabetos configuráveis em tempo de execução. Motores
+ * sequenciais (Xoshiro256StarStar, Pcg32, SplitMix64) têm estado menor e
+ * geram mais barato, mas não oferecem acesso direto por índice.
+ *
+ * @tparam Alphabet Tipo com membros size e symbolAt(id) constexpr (ex.: CharAlphabet)
+ * @tparam Engine Motor de números aleatórios (padrão: PhiloxEngine)
+ */
+template <typename Alphabet, typename Engine = PhiloxEngine>
+class BasicSequenceGenerator {
+public:
+    static constexpr size_t ALPHABET_SIZE = Alphabet::size;  ///< Número de símbolos
+    static constexpr uint8_t INVALID_SYMBOL = SequenceGenerator::INVALID_SYMBOL;  ///< Símbolo inexistente
+
+    static_assert(ALPHABET_SIZE >= 1 && ALPHABET_SIZE <= SequenceGenerator::MAX_SYMBOLS,
+                  "BasicSequenceGenerator: tamanho de alfabeto inválido");
+
+private:
+    /**
+     * @brief Busca recursiva (avaliável em tempo de compilação) de um símbolo
+     */
+    static constexpr uint8_t findFrom(char symbol, size_t id) {
+        return id >= ALPHABET_SIZE ? INVALID_SYMBOL
+             : Alphabet::symbolAt(id) == symbol ? static_cast<uint8_t>(id)
+             : findFrom(symbol, id + 1);
+    }
+
+    static constexpr bool POWER_OF_TWO = (ALPHABET_SIZE & (ALPHABET_SIZE - 1)) == 0;  ///< Redução por deslocamento
+    static constexpr unsigned SYMBOL_BITS = alphabetLog2(ALPHABET_SIZE);             ///< Bits por símbolo (potência de 2)
+
+    std::vector<uint8_t> sequence;  ///< Identificadores da sequência atual
+    size_t initialLength;           ///< Comprimento inicial da sequência
+    size_t maxSequenceLength;       ///< Comprimento máximo permitido
+    uint64_t seedValue;             ///< Semente atual
+    uint64_t sessionId;             ///< Sessão atual
+    Engine engine;                  ///< Motor de números aleatórios
+
+    /**
+     * @brief Sorteia o símbolo da posição informada (motor baseado em contador)
+     */
+    uint8_t drawSymbol(uint64_t index, std::true_type) {
+        return symbolIdForIndex(index);
+    }
+
+    /**
+     * @brief Sorteia o próximo símbolo do fluxo (motor sequencial)
+     */
+    uint8_t drawSymbol(uint64_t, std::false_type) {
+        if (ALPHABET_SIZE == 1) {
+            return 0;
+        }
+        if (POWER_OF_TWO) {
+            return static_cast<uint8_t>(engine.next32() >> ((32 - SYMBOL_BITS) & 31));
+        }
+        return static_cast<uint8_t>(boundedRandom(engine, static_cast<uint32_t>(ALPHABET_SIZE)));
+    }
+
+    /**
+     * @brief Recria a sequência inicial da sessão atual
+     */
+    void initializeSequence() {
+        engine.seed(seedValue, sessionId);
+        sequence.clear();
+        for (size_t i = 0; i < initialLength; ++i) {
+            addRandomElement();
+        }
+    }
+
+public:
+    /**
+     * @brief Construtor da classe BasicSequenceGenerator
+     * @param initialLength Comprimento inicial da sequência (padrão: 1)
+     * @param maxSequenceLength Comprimento máximo da sequência (padrão: 50)
+     * @throws std::invalid_argument se os comprimentos forem inválidos
+     */
+    explicit BasicSequenceGenerator(size_t initialLength = 1,
+                                    size_t maxSequenceLength = SequenceGenerator::DEFAULT_MAX_LENGTH)
+        : initialLength(initialLength), maxSequenceLength(maxSequenceLength),
+          seedValue(CounterRng::randomSeed()), sessionId(0), engine() {
+        if (initialLength < 1 || maxSequenceLength < initialLength) {
+            throw std::invalid_argument("BasicSequenceGenerator: comprimentos inválidos");
+        }
+        initializeSequence();
+    }
+
+    /**
+     * @brief Obtém o nome de um símbolo
+     * @param id Identificador (deve ser menor que ALPHABET_SIZE)
+     * @return Caractere do símbolo
+     */
+    static constexpr char symbolName(uint8_t id) {
+        return Alphabet::symbolAt(id);
+    }
+
+    /**
+     * @brief Obtém o identificador de um símbolo
+     * @param symbol Caractere do símbolo
+     * @return Identificador ou INVALID_SYMBOL se não pertencer ao alfabeto
+     */
+    static constexpr uint8_t findSymbolId(char symbol) {
+        return findFrom(symbol, 0);
+    }
+
+    /**
+     * @brief Calcula o símbolo gerado para uma posição da sessão atual
+     *
+     * Disponível apenas para motores baseados em contador.
+     *
+     * @param index Posição na sequência
+     * @return Identificador do símbolo
+     */
+    uint8_t symbolIdForIndex(uint64_t index) const {
+        static_assert(Engine::COUNTER_BASED, "symbolIdForIndex exige um motor baseado em contador");
+        const CounterRng& rng = engine.counterRng();
+        if (ALPHABET_SIZE == 1) {
+            return 0;
+        }
+        if (POWER_OF_TWO) {
+            // Lemire com range = 2^k nunca rejeita: (x * 2^k) >> 32 == x >> (32 - k)
+            return static_cast<uint8_t>(rng.blockAt(index)[0] >> ((32 - SYMBOL_BITS) & 31));
+        }
+        return static_cast<uint8_t>(rng.boundedAt(index, static_cast<uint32_t>(ALPHABET_SIZE)));
+    }
+
+    /**
+     * @brief Adiciona um elemento aleatório à sequência
+     * @return Símbolo adicionado ou '\0' se a sequência estiver no máximo
+     */
+    char addRandomElement() {
+        if (sequence.size() >= maxSequenceLength) {
+            return '\0';
+        }
+        uint8_t id = drawSymbol(sequence.size(), std::integral_constant<bool, Engine::COUNTER_BASED>());
+        sequence.push_back(id);
+        return symbolName(id);
+    }
+
+    /**
+     * @brief Reinicia a sequência, avançando para a próxima sessão
+     */
+    void reset() {
+        sessionId++;
+        initializeSequence();
+    }
+
+    /**
+     * @brief Define a semente e a sessão, regenerando a sequência inicial
+     * @param seed Semente do gerador
+     * @param session Identificador da sessão (padrão: 0)
+     */
+    void setSeed(uint64_t seed, uint64_t session = 0) {
+        seedValue = seed;
+        sessionId = session;
+        initializeSequence();
+    }
+
+    /**
+     * @brief Obtém a semente atual
+     * @return Semente do gerador
+     */
+    uint64_t getSeed() const {
+        return seedValue;
+    }
+
+    /**
+     * @brief Obtém a sessão atual
+     * @return Identificador da sessão
+     */
+    uint64_t getSessionId() const {
+        return sessionId;
+    }
+
+    /**
+     * @brief Obtém o comprimento da sequência
+     * @return Número de elementos
+     */
+    size_t getSequenceLength() const {
+        return sequence.size();
+    }
+
+    /**
+     * @brief Obtém o comprimento máximo da sequência
+     * @return Comprimento máximo permitido
+     */
+    size_t getMaxSequenceLength() const {
+        return maxSequenceLength;
+    }
+
+    /**
+     * @brief Verifica se a sequência atingiu o comprimento máximo
+     * @return true se estiver no comprimento máximo
+     */
+    bool isAtMaxLength() const {
+        return sequence.size() >= maxSequenceLength;
+    }
+
+    /**
+     * @brief Obtém o identificador do símbolo em uma posição
+     * @param index Índice do elemento
+     * @return Identificador ou INVALID_SYMBOL se o índice for inválido
+     */
+    uint8_t getSymbolIdAt(size_t index) const {
+        return index < sequence.size() ? sequence[index] : INVALID_SYMBOL;
+    }
+
+    /**
+     * @brief Obtém o símbolo em uma posição
+     * @param index Índice do elemento
+     * @return Símbolo ou '\0' se o índice for inválido
+     */
+    char getElementAt(size_t index) const {
+        return index < sequence.size() ? symbolName(sequence[index]) : '\0';
+    }
+
+    /**
+     * @brief Obtém os identificadores da sequência
+     * @return Referência para o vetor de identificadores
+     */
+    const std::vector<uint8_t>& getSymbolIds() const {
+        return sequence;
+    }
+
+    /**
+     * @brief Converte a sequência para string (um caractere por símbolo)
+     * @return Sequência como string
+     */
+    std::string toString() const {
+        std::string result(sequence.size(), '\0');
+        for (size_t i = 0; i < sequence.size(); ++i) {
+            result[i] = symbolName(sequence[i]);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Localiza a primeira divergência com uma sequência de identificadores
+     *
+     * Compara 8 identificadores por iteração (uma palavra de 64 bits) e só
+     * examina byte a byte a palavra divergente e o final.
+     *
+     * @param userSymbolIds Identificadores informados
+     * @param count Número de identificadores a comparar
+     * @return Índice da primeira divergência ou min(count, comprimento) se iguais
+     */
+    size_t firstMismatch(const uint8_t* userSymbolIds, size_t count) const {
+        size_t n = count < sequence.size() ? count : sequence.size();
+        const uint8_t* expected = sequence.data();
+        size_t i = 0;
+
+        for (; i + 8 <= n; i += 8) {
+            uint64_t a, b;
+            std::memcpy(&a, userSymbolIds + i, sizeof(a));
+            std::memcpy(&b, expected + i, sizeof(b));
+            if (a != b) {
+                break;
+            }
+        }
+        for (; i < n; ++i) {
+            if (userSymbolIds[i] != expected[i]) {
+                return i;
+            }
+        }
+        return n;
+    }
+
+    /**
+     * @brief Valida uma sequência de identificadores
+     * @param userSymbolIds Identificadores informados
+     * @param upToIndex Verifica apenas até este índice (para validação parcial)
+     * @return Par com status de sucesso e posição do erro (se houver)
+     */
+    std::pair<bool, int> validateUserSequence(const std::vector<uint8_t>& userSymbolIds,
+                                             int upToIndex = -1) const {
+        size_t checkLength = userSymbolIds.size();
+        if (upToIndex >= 0 && static_cast<size_t>(upToIndex + 1) < checkLength) {
+            checkLength = static_cast<size_t>(upToIndex + 1);
+        }
+
+        size_t position = firstMismatch(userSymbolIds.data(), checkLength);
+        if (position < checkLength) {
+            return std::make_pair(false, static_cast<int>(position));
+        }
+        return std::make_pair(true, static_cast<int>(checkLength) - 1);
+    }
+
+    /**
+     * @brief Valida uma sequência de símbolos (um caractere por símbolo)
+     * @param userSymbols Símbolos informados (ex.: "ABDC")
+     * @param upToIndex Verifica apenas até este índice (para validação parcial)
+     * @return Par com status de sucesso e posição do erro (se houver)
+     */
+    std::pair<bool, int> validateUserSequence(const std::string& userSymbols,
+                                             int upToIndex = -1) const {
+        std::vector<uint8_t> ids(userSymbols.size());
+        for (size_t i = 0; i < userSymbols.size(); ++i) {
+            ids[i] = findSymbolId(userSymbols[i]);
+        }
+        return validateUserSequence(ids, upToIndex);
+    }
+
+    /**
+     * @brief Cria um SequenceGenerator equivalente (alfabeto em tempo de execução)
+     *
+     * Disponível apenas com PhiloxEngine, o mesmo gerador do SequenceGenerator.
+     *
+     * @return Gerador com o mesmo alfabeto, semente, sessão e sequência
+     */
+    SequenceGenerator toGenerator() const {
+        static_assert(Engine::COUNTER_BASED, "toGenerator exige um motor baseado em contador");
+        std::vector<std::string> colors;
+        std::vector<std::string> current;
+        for (size_t id = 0; id < ALPHABET_SIZE; ++id) {
+            colors.push_back(std::string(1, Alphabet::symbolAt(id)));
+        }
+        for (uint8_t id : sequence) {
+            current.push_back(colors[id]);
+        }
+
+        SequenceGenerator generator(colors, initialLength, maxSequenceLength);
+        generator.setSeed(seedValue, sessionId);
+        generator.setCustomSequence(current);
+        return generator;
+    }
+};
+
+template <typename Alphabet, typename Engine>
+constexpr size_t BasicSequenceGenerator<Alphabet, Engine>::ALPHABET_SIZE;
+
+template <typename Alphabet, typename Engine>
+constexpr uint8_t BasicSequenceGenerator<Alphabet, Engine>::INVALID_SYMBOL;
+
+/// Gerador do alfabeto padrão {"A", "B", "C", "D"}
+typedef BasicSequenceGenerator<AlphabetABCD> ClassicSequenceGenerator;
+
+#endif // BASIC_SEQUENCE_GENERATOR_H
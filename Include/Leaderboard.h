@@ -0,0 +1,357 @@
+/**
+ * @file Leaderboard.h
+ * @brief Declaração da classe Leaderboard - pontuações ordenadas com limite (top-K)
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+
+#include "ScoreEntry.h"
+#include "ScoreIndex.h"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <set>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+/**
+ * @class Leaderboard
+ * @brief Lista de pontuações em ordem decrescente com no máximo K entradas
+ *
+ * As entradas ficam em blocos ordenados de até 2 * BLOCK_SIZE elementos cuja
+ * concatenação é o ranking. Uma inserção localiza o bloco por busca binária
+ * sobre o último elemento de cada bloco, insere por busca binária dentro
+ * dele e divide o bloco quando ele enche, de modo que o custo não cresce com
+ * K como um vetor único (deslocamento de todas as entradas seguintes) ou uma
+ * ordenação completa. A posição de inserção já é a colocação da entrada.
+ *
+ * Entradas empatadas pelo ScoreEntry::operator> mantêm a ordem de chegada:
+ * a mais antiga fica à frente.
+ *
+ * Cada entrada recebe um número de chegada; o ranking é uma ordem total
+ * por (ScoreEntry::operator>, chegada). Um ScoreIndex com as pontuações
+ * presentes e um índice por jogador (nome em minúsculas para o conjunto
+ * ordenado das chaves de suas entradas) são atualizados por todas as
+ * operações que alteram o ranking, inclusive os descartes por capacidade.
+ * O índice por jogador guarda só chaves pequenas; as entradas são obtidas
+ * dos blocos por busca binária.
+ */
+class Leaderboard {
+public:
+    static const size_t BLOCK_SIZE = 512;  ///< Tamanho de cada metade após a divisão de um bloco
+
+private:
+    /**
+     * @struct Slot
+     * @brief Entrada armazenada com seu número de chegada
+     */
+    struct Slot {
+        ScoreEntry entry;   ///< Dados da pontuação
+        uint64_t sequence;  ///< Ordem de chegada (desempata entradas iguais)
+    };
+
+    /**
+     * @struct RankKey
+     * @brief Campos que determinam a colocação de uma entrada
+     */
+    struct RankKey {
+        int score;          ///< Pontuação
+        int level;          ///< Nível
+        int streak;         ///< Sequência de acertos
+        double accuracy;    ///< Precisão
+        uint64_t sequence;  ///< Ordem de chegada
+    };
+
+    /**
+     * @struct RankKeyOrder
+     * @brief Ordem do ranking entre chaves (mesma de ScoreEntry::operator>, depois chegada)
+     */
+    struct RankKeyOrder {
+        bool operator()(const RankKey& a, const RankKey& b) const;
+    };
+
+    typedef std::set<RankKey, RankKeyOrder> PlayerKeys;  ///< Chaves das entradas de um jogador
+
+public:
+    /**
+     * @class const_iterator
+     * @brief Iterador somente leitura em ordem de colocação
+     */
+    class const_iterator {
+        const std::vector<std::vector<Slot>>* blocks;        ///< Blocos percorridos
+        size_t block;                                        ///< Bloco atual
+        size_t offset;                                       ///< Posição no bloco atual
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef ScoreEntry value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const ScoreEntry* pointer;
+        typedef const ScoreEntry& reference;
+
+        const_iterator(const std::vector<std::vector<Slot>>* blocks, size_t block, size_t offset)
+            : blocks(blocks), block(block), offset(offset) {}
+
+        reference operator*() const { return (*blocks)[block][offset].entry; }
+        pointer operator->() const { return &(*blocks)[block][offset].entry; }
+
+        const_iterator& operator++() {
+            if (++offset == (*blocks)[block].size()) {
+                ++block;
+                offset = 0;
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return block == other.block && offset == other.offset;
+        }
+
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+    };
+
+private:
+    std::vector<std::vector<Slot>> blocks;        ///< Blocos não vazios, em ordem de colocação
+    size_t count;                                 ///< Total de entradas
+    size_t capacity;                              ///< Máximo de entradas (K)
+    uint64_t nextSequence;                        ///< Próximo número de chegada
+    ScoreIndex scoreIndex;                        ///< Pontuações presentes, para consultas de ordem
+    std::unordered_map<std::string, PlayerKeys> playerKeys; ///< Chaves das entradas por nome normalizado
+
+    /**
+     * @brief Obtém a chave de colocação de uma entrada armazenada
+     */
+    static RankKey keyOf(const Slot& slot);
+
+    /**
+     * @brief Localiza a entrada armazenada com uma chave (que deve existir)
+     */
+    const Slot& findSlot(const RankKey& key) const;
+
+    /**
+     * @brief Localiza o bloco e a posição de um índice global
+     */
+    void locate(size_t index, size_t& block, size_t& offset) const;
+
+    /**
+     * @brief Descarta as últimas entradas até respeitar a capacidade
+     */
+    void trim();
+
+    /**
+     * @brief Reconstrói os índices a partir dos blocos
+     */
+    void rebuildIndexes();
+
+    /**
+     * @brief Remove uma entrada dos índices
+     */
+    void unindex(const Slot& slot);
+
+public:
+    /**
+     * @brief Construtor da classe Leaderboard
+     * @param capacity Número máximo de entradas (mínimo 1)
+     */
+    explicit Leaderboard(size_t capacity);
+
+    /**
+     * @brief Obtém o número de entradas
+     * @return Entradas no ranking
+     */
+    size_t size() const;
+
+    /**
+     * @brief Verifica se o ranking está vazio
+     * @return true se não há entradas
+     */
+    bool empty() const;
+
+    /**
+     * @brief Verifica se o ranking atingiu a capacidade
+     * @return true se size() == getCapacity()
+     */
+    bool full() const;
+
+    /**
+     * @brief Obtém a capacidade
+     * @return Número máximo de entradas
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief Define a capacidade, descartando as últimas entradas se necessário
+     * @param newCapacity Novo número máximo de entradas (mínimo 1)
+     * @return Número de entradas descartadas
+     */
+    size_t setCapacity(size_t newCapacity);
+
+    /**
+     * @brief Verifica em O(1) se uma entrada entraria no ranking
+     * @param entry Entrada candidata
+     * @return true se há espaço ou a entrada supera a última colocada
+     */
+    bool qualifies(const ScoreEntry& entry) const;
+
+    /**
+     * @brief Insere uma entrada na posição ordenada
+     *
+     * Se o ranking está cheio, a última entrada é descartada para dar lugar
+     * à nova; entradas que não se qualificam são rejeitadas sem alterar nada.
+     *
+     * @param entry Entrada a inserir
+     * @return Colocação da entrada (1 = primeiro lugar) ou 0 se foi rejeitada
+     */
+    size_t insert(const ScoreEntry& entry);
+
+    /**
+     * @brief Substitui o conteúdo por uma lista qualquer de entradas
+     *
+     * A lista é ordenada de forma estável (empates mantêm a ordem da lista) e
+     * truncada à capacidade.
+     *
+     * @param entries Entradas em qualquer ordem
+     */
+    void assign(std::vector<ScoreEntry> entries);
+
+    /**
+     * @brief Remove a entrada de uma colocação
+     * @param index Índice (0 = primeiro lugar), deve ser menor que size()
+     */
+    void erase(size_t index);
+
+    /**
+     * @brief Remove as entradas que satisfazem um predicado
+     * @param predicate Função que recebe a entrada e retorna true para removê-la
+     * @return Número de entradas removidas
+     */
+    template<typename Predicate>
+    size_t removeIf(Predicate predicate) {
+        std::vector<ScoreEntry> kept;
+        kept.reserve(count);
+        for (auto& block : blocks) {
+            for (auto& slot : block) {
+                if (!predicate(slot.entry)) {
+                    kept.push_back(std::move(slot.entry));
+                }
+            }
+        }
+        size_t removed = count - kept.size();
+        assign(std::move(kept));
+        return removed;
+    }
+
+    /**
+     * @brief Remove todas as entradas de um jogador (sem diferenciar maiúsculas)
+     * @param playerName Nome do jogador
+     * @return Número de entradas removidas
+     */
+    size_t removePlayer(const std::string& playerName);
+
+    /**
+     * @brief Remove todas as entradas
+     */
+    void clear();
+
+    /**
+     * @brief Obtém as entradas de um jogador (sem diferenciar maiúsculas)
+     * @param playerName Nome do jogador
+     * @return Entradas em ordem de colocação (vazio se o jogador não tem entradas)
+     */
+    std::vector<ScoreEntry> getPlayerEntries(const std::string& playerName) const;
+
+    /**
+     * @brief Obtém a melhor entrada de um jogador (sem diferenciar maiúsculas)
+     * @param playerName Nome do jogador
+     * @return Ponteiro válido até a próxima alteração ou nullptr se o jogador não tem entradas
+     */
+    const ScoreEntry* findPlayerBest(const std::string& playerName) const;
+
+    /**
+     * @brief Obtém o número de entradas de um jogador (sem diferenciar maiúsculas)
+     * @param playerName Nome do jogador
+     * @return Número de entradas do jogador
+     */
+    size_t getPlayerEntryCount(const std::string& playerName) const;
+
+    /**
+     * @brief Obtém o número de jogadores distintos (sem diferenciar maiúsculas)
+     * @return Número de jogadores com entradas
+     */
+    size_t getPlayerCount() const;
+
+    /**
+     * @brief Normaliza um nome para comparação sem diferenciar maiúsculas
+     * @param playerName Nome do jogador
+     * @return Nome em minúsculas
+     */
+    static std::string normalizeName(const std::string& playerName);
+
+    /**
+     * @brief Obtém a entrada de uma colocação
+     * @param index Índice (0 = primeiro lugar), deve ser menor que size()
+     * @return Referência válida até a próxima alteração
+     */
+    const ScoreEntry& operator[](size_t index) const;
+
+    /**
+     * @brief Obtém o primeiro lugar (o ranking não pode estar vazio)
+     */
+    const ScoreEntry& front() const;
+
+    /**
+     * @brief Obtém o último lugar (o ranking não pode estar vazio)
+     */
+    const ScoreEntry& back() const;
+
+    /**
+     * @brief Copia as primeiras entradas para um vetor
+     * @param limit Número máximo de entradas
+     * @return Entradas em ordem de colocação
+     */
+    std::vector<ScoreEntry> toVector(size_t limit) const;
+
+    /**
+     * @brief Copia todas as entradas para um vetor
+     * @return Entradas em ordem de colocação
+     */
+    std::vector<ScoreEntry> toVector() const;
+
+    /**
+     * @brief Obtém o índice de estatísticas de ordem das pontuações presentes
+     * @return Índice sincronizado com o ranking
+     */
+    const ScoreIndex& getIndex() const;
+
+    /**
+     * @brief Obtém o número de blocos em uso
+     * @return Número de blocos
+     */
+    size_t getBlockCount() const;
+
+    /**
+     * @brief Obtém o iterador para o primeiro lugar
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Obtém o iterador para depois do último lugar
+     */
+    const_iterator end() const;
+};
+
+#endif // LEADERBOARD_H
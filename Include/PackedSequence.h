@@ -0,0 +1,229 @@
+/**
+ * @file PackedSequence.h
+ * @brief Declaração da classe PackedSequence - sequência de símbolos compactada em bits
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef PACKED_SEQUENCE_H
+#define PACKED_SEQUENCE_H
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class PackedSequence
+ * @brief Armazena identificadores de símbolos com 2, 4 ou 8 bits por elemento
+ *
+ * Os elementos são empacotados em palavras de 64 bits, do bit menos
+ * significativo para o mais significativo. Os bits não utilizados da última
+ * palavra são sempre zero, o que permite comparar prefixos palavra a palavra
+ * (com SSE2/AVX2 quando disponíveis) e localizar a primeira divergência com
+ * uma contagem de zeros à direita (ctz).
+ *
+ * As palavras ficam em blocos de tamanho crescente (o bloco k tem
+ * BASE_CHUNK_WORDS * 2^k palavras). Crescer apenas aloca um novo bloco, sem
+ * copiar os anteriores, e o bloco de uma palavra é obtido em O(1) pela
+ * posição do bit mais significativo. Em sequências longas, no máximo
+ * metade da memória alocada fica sem uso.
+ */
+class PackedSequence {
+private:
+    static const size_t BASE_CHUNK_WORDS = 8;  ///< Palavras do primeiro bloco
+
+    std::vector<std::unique_ptr<uint64_t[]>> chunks;  ///< Blocos de palavras (tamanhos crescentes)
+    size_t length;                ///< Número de elementos armazenados
+    unsigned bitsPerSymbol;       ///< Bits por elemento (2, 4 ou 8)
+    unsigned wordShift;           ///< log2 do número de elementos por palavra
+    uint64_t symbolMask;          ///< Máscara de um elemento
+
+    /**
+     * @brief Compara dois vetores de palavras
+     * @param a Primeiro vetor
+     * @param b Segundo vetor
+     * @param count Número de palavras a comparar
+     * @return Índice da primeira palavra diferente, ou count se forem iguais
+     */
+    static size_t firstMismatchWord(const uint64_t* a, const uint64_t* b, size_t count);
+
+    /**
+     * @brief Localiza o bloco de uma palavra
+     * @param wordIndex Índice global da palavra
+     * @param offset Recebe o índice da palavra dentro do bloco
+     * @return Índice do bloco
+     */
+    static size_t chunkOf(size_t wordIndex, size_t& offset);
+
+    /**
+     * @brief Obtém o número de palavras de um bloco
+     * @param chunk Índice do bloco
+     * @return Capacidade do bloco em palavras
+     */
+    static size_t chunkWords(size_t chunk);
+
+    /**
+     * @brief Obtém o número de palavras em uso
+     * @return Palavras necessárias para os elementos armazenados
+     */
+    size_t usedWords() const;
+
+    /**
+     * @brief Obtém uma palavra pelo índice global
+     * @param wordIndex Índice da palavra (deve estar em uso)
+     * @return Valor da palavra
+     */
+    uint64_t wordAt(size_t wordIndex) const;
+
+public:
+    /**
+     * @brief Construtor da classe PackedSequence
+     * @param bitsPerSymbol Bits por elemento (2, 4 ou 8; outros valores usam 8)
+     */
+    explicit PackedSequence(unsigned bitsPerSymbol = 8);
+
+    /**
+     * @brief Construtor de cópia (copia apenas as palavras em uso)
+     * @param other Objeto a ser copiado
+     */
+    PackedSequence(const PackedSequence& other);
+
+    /**
+     * @brief Construtor de movimentação
+     * @param other Objeto a ser movido (fica vazio)
+     */
+    PackedSequence(PackedSequence&& other) noexcept;
+
+    /**
+     * @brief Operador de atribuição por cópia (reaproveita os blocos já alocados)
+     * @param other Objeto a ser atribuído
+     * @return Referência para este objeto
+     */
+    PackedSequence& operator=(const PackedSequence& other);
+
+    /**
+     * @brief Operador de atribuição por movimentação
+     * @param other Objeto a ser movido (fica vazio)
+     * @return Referência para este objeto
+     */
+    PackedSequence& operator=(PackedSequence&& other) noexcept;
+
+    /**
+     * @brief Calcula a largura mínima de elemento para um alfabeto
+     * @param alphabetSize Número de símbolos do alfabeto
+     * @return 2 para até 4 símbolos, 4 para até 16 e 8 nos demais casos
+     */
+    static unsigned bitsForAlphabet(size_t alphabetSize);
+
+    /**
+     * @brief Adiciona um elemento ao final da sequência
+     * @param symbolId Identificador do símbolo (deve caber na largura configurada)
+     */
+    void push_back(uint8_t symbolId);
+
+    /**
+     * @brief Obtém o elemento em uma posição
+     * @param index Índice do elemento (deve ser menor que size())
+     * @return Identificador do símbolo
+     */
+    uint8_t get(size_t index) const;
+
+    /**
+     * @brief Substitui o conteúdo por uma sequência de identificadores
+     * @param symbolIds Identificadores dos símbolos
+     */
+    void assign(const std::vector<uint8_t>& symbolIds);
+
+    /**
+     * @brief Converte a sequência para um vetor de identificadores
+     * @return Vetor com um byte por elemento
+     */
+    std::vector<uint8_t> toIds() const;
+
+    /**
+     * @brief Reempacota a sequência com outra largura de elemento
+     * @param newBitsPerSymbol Nova largura (2, 4 ou 8)
+     */
+    void repack(unsigned newBitsPerSymbol);
+
+    /**
+     * @brief Remove todos os elementos (os blocos alocados são reaproveitados)
+     */
+    void clear();
+
+    /**
+     * @brief Obtém o número de elementos
+     * @return Número de elementos
+     */
+    size_t size() const;
+
+    /**
+     * @brief Verifica se a sequência está vazia
+     * @return true se não houver elementos
+     */
+    bool empty() const;
+
+    /**
+     * @brief Obtém a largura de cada elemento
+     * @return Bits por elemento
+     */
+    unsigned getBitsPerSymbol() const;
+
+    /**
+     * @brief Obtém o número de bytes ocupados pelas palavras empacotadas
+     * @return Tamanho em bytes
+     */
+    size_t getStorageBytes() const;
+
+    /**
+     * @brief Copia as palavras em uso para um buffer contíguo
+     * @param out Destino (deve ter espaço para getStorageBytes() bytes)
+     * @return Número de palavras copiadas
+     */
+    size_t exportWords(uint64_t* out) const;
+
+    /**
+     * @brief Substitui o conteúdo por palavras já empacotadas na largura atual
+     *
+     * Copia bloco a bloco (um memcpy por bloco), sem desempacotar elementos.
+     * Os bits além do último elemento são zerados.
+     *
+     * @param source Palavras de origem ((length + elementos por palavra - 1) / elementos por palavra)
+     * @param newLength Número de elementos representados
+     */
+    void importWords(const uint64_t* source, size_t newLength);
+
+    /**
+     * @brief Obtém o número de bytes alocados pelos blocos
+     * @return Tamanho em bytes
+     */
+    size_t getAllocatedBytes() const;
+
+    /**
+     * @brief Localiza a primeira divergência entre duas sequências
+     * @param a Primeira sequência
+     * @param b Segunda sequência
+     * @param count Número máximo de elementos a comparar
+     * @return Índice do primeiro elemento diferente, ou min(count, a.size(), b.size())
+     *         se os prefixos forem iguais
+     */
+    static size_t firstMismatch(const PackedSequence& a, const PackedSequence& b, size_t count);
+
+    /**
+     * @brief Operador de igualdade (compara os elementos, não a largura)
+     * @param other Outra sequência
+     * @return true se as sequências tiverem os mesmos elementos
+     */
+    bool operator==(const PackedSequence& other) const;
+
+    /**
+     * @brief Operador de desigualdade
+     * @param other Outra sequência
+     * @return true se as sequências forem diferentes
+     */
+    bool operator!=(const PackedSequence& other) const;
+};
+
+#endif // PACKED_SEQUENCE_H
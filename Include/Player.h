@@ -13,6 +13,98 @@
 #include <vector>
 #include <chrono>
 #include <map>
+#include <memory>
+#include <cstdint>
+#include "PlayerHistory.h"
+#include "ReactionTimeStats.h"
+
+/**
+ * @struct PlayerStats
+ * @brief Retrato numérico das estatísticas do jogador (sem alocações)
+ */
+struct PlayerStats {
+    int score;                   ///< Pontuação atual
+    int level;                   ///< Nível atual
+    int lives;                   ///< Vidas restantes
+    int maxLives;                ///< Número máximo de vidas
+    int totalCorrectSequences;   ///< Total de sequências corretas
+    int totalWrongAttempts;      ///< Total de tentativas incorretas
+    int currentStreak;           ///< Sequência atual de acertos
+    int bestStreak;              ///< Melhor sequência de acertos
+    double accuracy;             ///< Precisão em porcentagem (0 sem tentativas)
+    double averageReactionTime;  ///< Tempo médio de reação calculado no fim do jogo (ms)
+    double reactionTimeP50;      ///< Mediana do tempo de reação (ms)
+    double reactionTimeP90;      ///< Percentil 90 do tempo de reação (ms)
+    double reactionTimeP99;      ///< Percentil 99 do tempo de reação (ms)
+    double maxReactionTime;      ///< Maior tempo de reação (ms)
+    long long gameDuration;      ///< Duração do jogo em milissegundos
+    bool isGameActive;           ///< Jogo iniciado e ainda não terminado
+    bool isAlive;                ///< Jogador ainda tem vidas
+};
+
+/**
+ * @struct PlayerProfile
+ * @brief Perfil binário de layout fixo com o estado persistente completo do jogador
+ *
+ * O perfil é gravado e lido com uma única chamada de write/read. Os campos
+ * usam a representação nativa da plataforma (como o arquivo de spill do
+ * histórico); qualquer mudança de layout exige incrementar VERSION. O campo
+ * checksum é um FNV-1a de 32 bits de todos os bytes anteriores a ele.
+ */
+struct PlayerProfile {
+    static const uint32_t MAGIC = 0x46525053;  ///< "SPRF" em little-endian
+    static const uint16_t VERSION = 1;         ///< Versão do layout
+    static const size_t NAME_SIZE = 24;        ///< Bytes do nome, incluindo o terminador
+
+    uint32_t magic;                    ///< MAGIC
+    uint16_t version;                  ///< VERSION
+    uint16_t size;                     ///< sizeof(PlayerProfile)
+    char name[NAME_SIZE];              ///< Nome do jogador (terminado em '\0')
+    int32_t score;                     ///< Pontuação
+    int32_t level;                     ///< Nível
+    int32_t currentLives;              ///< Vidas restantes
+    int32_t maxLives;                  ///< Número máximo de vidas
+    int32_t totalCorrectSequences;     ///< Total de sequências corretas
+    int32_t totalWrongAttempts;        ///< Total de tentativas incorretas
+    int32_t bestStreak;                ///< Melhor sequência de acertos
+    int32_t currentStreak;             ///< Sequência atual de acertos
+    int64_t gameDuration;              ///< Duração do último jogo (ms)
+    int64_t savedAt;                   ///< Instante do salvamento (segundos desde a época Unix)
+    double averageReactionTime;        ///< Tempo médio de reação (ms)
+    ReactionTimeStats reactionStats;   ///< Histograma e momentos dos tempos de reação
+    uint32_t checksum;                 ///< FNV-1a dos bytes anteriores
+    uint32_t reserved;                 ///< Zero (completa o alinhamento)
+};
+
+/**
+ * @struct PlayerHotState
+ * @brief Contadores e instantes consultados a cada jogada (cabem em uma linha de cache)
+ */
+struct PlayerHotState {
+    int score;                                 ///< Pontuação atual
+    int level;                                 ///< Nível atual
+    int currentLives;                          ///< Vidas restantes
+    int maxLives;                              ///< Número máximo de vidas
+    int totalCorrectSequences;                 ///< Total de sequências corretas
+    int totalWrongAttempts;                    ///< Total de tentativas incorretas
+    int bestStreak;                            ///< Melhor sequência de acertos
+    int currentStreak;                         ///< Sequência atual de acertos
+    std::chrono::steady_clock::time_point gameStartTime; ///< Tempo de início do jogo
+    std::chrono::steady_clock::time_point gameEndTime;   ///< Tempo de fim do jogo
+    std::chrono::steady_clock::time_point lastInputTime; ///< Tempo da última entrada
+};
+
+/**
+ * @struct PlayerColdState
+ * @brief Dados do jogador consultados raramente ou de tamanho variável
+ */
+struct PlayerColdState {
+    std::string name;                              ///< Nome do jogador
+    double averageReactionTime;                    ///< Tempo médio de reação
+    std::vector<std::string> currentInputSequence; ///< Sequência de entrada atual
+    ReactionTimeStats reactionStats;               ///< Distribuição dos tempos de reação (memória fixa)
+    PlayerHistory gameHistory;                     ///< Histórico do jogo (eventos tipados)
+};
 
 /**
  * @class Player
@@ -21,25 +113,20 @@
  * Esta classe encapsula todos os dados relacionados ao jogador, incluindo
  * pontuação, vidas, sequências de entrada, estatísticas de desempenho
  * e histórico do jogo para análise posterior.
+ *
+ * Os contadores frequentes ficam em um bloco compacto (PlayerHotState) logo
+ * no início do objeto; nome, entradas, histogramas e histórico ficam em um
+ * bloco frio alocado à parte. A classe não tem funções virtuais, então não
+ * há ponteiro de vtable antes do bloco quente: um jogador armazenado em um
+ * endereço múltiplo de 64 tem o estado quente inteiro em uma linha de cache.
+ * O bloco não é declarado alignas(64) porque em C++11 o operator new e o
+ * std::allocator não garantem alinhamentos acima do fundamental. Mover um
+ * jogador apenas transfere o ponteiro do bloco frio.
  */
 class Player {
 private:
-    std::string name;                           ///< Nome do jogador
-    int maxLives;                              ///< Número máximo de vidas
-    int currentLives;                          ///< Vidas restantes
-    int score;                                 ///< Pontuação atual
-    int level;                                 ///< Nível atual
-    std::vector<std::string> currentInputSequence; ///< Sequência de entrada atual
-    int totalCorrectSequences;                 ///< Total de sequências corretas
-    int totalWrongAttempts;                    ///< Total de tentativas incorretas
-    std::chrono::steady_clock::time_point gameStartTime; ///< Tempo de início do jogo
-    std::chrono::steady_clock::time_point gameEndTime;   ///< Tempo de fim do jogo
-    int bestStreak;                            ///< Melhor sequência de acertos
-    int currentStreak;                         ///< Sequência atual de acertos
-    double averageReactionTime;                ///< Tempo médio de reação
-    std::vector<double> reactionTimes;         ///< Tempos de reação individuais
-    std::chrono::steady_clock::time_point lastInputTime; ///< Tempo da última entrada
-    std::vector<std::map<std::string, std::string>> gameHistory; ///< Histórico do jogo
+    PlayerHotState hot;                        ///< Estado quente (≤ 64 bytes, primeiro membro do objeto)
+    std::unique_ptr<PlayerColdState> cold;     ///< Estado frio (nulo apenas após movimentação)
 
     /**
      * @brief Valida e sanitiza o nome do jogador
@@ -53,6 +140,36 @@ private:
      */
     void initializePlayerState();
 
+    /**
+     * @brief Soma pontos e registra o evento com um motivo já internado
+     * @param points Pontos a serem adicionados (não negativos)
+     * @param reasonId Identificador do motivo no histórico
+     * @param reasonParam Parâmetro dos motivos predefinidos
+     */
+    void applyScore(int points, uint32_t reasonId, int32_t reasonParam = 0);
+
+    /**
+     * @brief Verifica se os campos de um perfil formam um estado válido
+     * @param profile Perfil (o checksum não é conferido)
+     * @return true se nome, vidas, nível e contadores são aceitáveis
+     */
+    static bool hasValidFields(const PlayerProfile& profile);
+
+    /**
+     * @brief Copia nome, contadores e estatísticas de reação de um perfil
+     *
+     * Não altera os instantes do jogo nem a sequência de entrada atual.
+     *
+     * @param profile Perfil já validado
+     */
+    void applyProfileFields(const PlayerProfile& profile);
+
+    /**
+     * @brief Reconstrói os instantes do jogo como terminado agora com uma duração
+     * @param gameDuration Duração em milissegundos (0 deixa os instantes zerados)
+     */
+    void applyGameDuration(int64_t gameDuration);
+
 public:
     /**
      * @brief Construtor da classe Player
@@ -62,9 +179,12 @@ public:
     explicit Player(const std::string& name = "Anonymous", int lives = 3);
 
     /**
-     * @brief Destrutor virtual padrão
+     * @brief Destrutor padrão
+     *
+     * Não é virtual: sem ponteiro de vtable, o estado quente começa no
+     * primeiro byte do objeto.
      */
-    virtual ~Player() = default;
+    ~Player() = default;
 
     /**
      * @brief Construtor de cópia
@@ -73,12 +193,34 @@ public:
     Player(const Player& other);
 
     /**
-     * @brief Operador de atribuição
+     * @brief Construtor de movimentação
+     *
+     * O objeto movido só pode ser destruído ou receber uma nova atribuição.
+     *
+     * @param other Objeto a ser movido
+     */
+    Player(Player&& other) noexcept;
+
+    /**
+     * @brief Operador de atribuição (reaproveita o bloco frio já alocado)
      * @param other Objeto a ser atribuído
      * @return Referência para este objeto
      */
     Player& operator=(const Player& other);
 
+    /**
+     * @brief Operador de atribuição por movimentação
+     * @param other Objeto a ser movido (só pode ser destruído ou receber atribuição)
+     * @return Referência para este objeto
+     */
+    Player& operator=(Player&& other) noexcept;
+
+    /**
+     * @brief Obtém o bloco de estado quente do jogador
+     * @return Referência para os contadores e instantes do jogo
+     */
+    const PlayerHotState& getHotState() const;
+
     /**
      * @brief Obtém o nome do jogador
      * @return Nome do jogador
@@ -198,12 +340,29 @@ public:
      */
     std::string getFormattedGameDuration() const;
 
+    /**
+     * @brief Obtém as estatísticas do jogador em campos numéricos
+     * @return Retrato das estatísticas atuais
+     */
+    PlayerStats getStats() const;
+
     /**
      * @brief Obtém estatísticas abrangentes do jogador
+     *
+     * Adaptador de compatibilidade sobre getStats(); prefira getStats() em
+     * caminhos frequentes.
+     *
      * @return Mapa com estatísticas do jogador
      */
     std::map<std::string, std::string> getStatistics() const;
 
+    /**
+     * @brief Formata uma precisão com uma casa decimal (ex.: "87.5")
+     * @param accuracy Precisão em porcentagem
+     * @return Texto formatado
+     */
+    static std::string formatAccuracy(double accuracy);
+
     /**
      * @brief Obtém total de tentativas (corretas + erradas)
      * @return Total de tentativas feitas
@@ -212,10 +371,52 @@ public:
 
     /**
      * @brief Obtém histórico do jogo para análise
+     *
+     * Os mapas são construídos a partir dos eventos tipados a cada chamada;
+     * prefira getHistory() em caminhos frequentes.
+     *
      * @return Vetor com eventos do jogo
      */
     std::vector<std::map<std::string, std::string>> getGameHistory() const;
 
+    /**
+     * @brief Obtém as estatísticas de tempo de reação do jogo atual
+     *
+     * Média, variância e percentis ficam disponíveis durante a partida e
+     * podem ser combinados entre jogadores com ReactionTimeStats::merge().
+     *
+     * @return Referência para o acumulador de tempos de reação
+     */
+    const ReactionTimeStats& getReactionStats() const;
+
+    /**
+     * @brief Obtém o histórico tipado do jogo
+     * @return Referência para o histórico de eventos
+     */
+    const PlayerHistory& getHistory() const;
+
+    /**
+     * @brief Limita o número de eventos do histórico mantidos em memória
+     * @param capacity Número máximo de eventos recentes (0 = sem limite)
+     */
+    void setHistoryCapacity(size_t capacity);
+
+    /**
+     * @brief Grava o histórico completo em um arquivo binário de acréscimo
+     *
+     * Permite analisar jogos longos por inteiro mesmo com o histórico em
+     * memória limitado. Cópias do jogador não gravam no arquivo.
+     *
+     * @param path Caminho do arquivo
+     * @return true se o arquivo foi aberto
+     */
+    bool enableHistorySpill(const std::string& path);
+
+    /**
+     * @brief Encerra a gravação do histórico em arquivo
+     */
+    void disableHistorySpill();
+
     /**
      * @brief Reinicia todos os dados do jogador para um novo começo
      */
@@ -223,17 +424,66 @@ public:
 
     /**
      * @brief Cria um objeto pronto para salvamento dos dados do jogador
+     *
+     * Adaptador sobre toProfile() para quem usa o formato de mapa.
+     *
      * @return Mapa com dados serializáveis do jogador
      */
     std::map<std::string, std::string> toSaveData() const;
 
     /**
      * @brief Carrega dados do jogador de um objeto de salvamento
+     *
+     * Usa a mesma validação e cópia de campos de fromProfile(): as chaves
+     * presentes substituem os campos correspondentes do estado atual e as
+     * ausentes são mantidas. Um jogo em andamento continua em andamento e a
+     * entrada pendente é preservada; os instantes do jogo só são refeitos
+     * quando o mapa traz "gameDuration".
+     *
      * @param saveData Dados do jogador previamente salvos
      * @return true se os dados foram carregados com sucesso
      */
     bool fromSaveData(const std::map<std::string, std::string>& saveData);
 
+    /**
+     * @brief Gera o perfil binário com o estado persistente do jogador
+     * @return Perfil preenchido e com checksum calculado
+     */
+    PlayerProfile toProfile() const;
+
+    /**
+     * @brief Restaura o estado do jogador a partir de um perfil binário
+     *
+     * O perfil é validado (assinatura, versão, tamanho, checksum e faixas dos
+     * campos) antes de qualquer alteração; um perfil inválido não modifica o
+     * jogador. O histórico de eventos não faz parte do perfil.
+     *
+     * @param profile Perfil a carregar
+     * @return true se o perfil era válido e foi carregado
+     */
+    bool fromProfile(const PlayerProfile& profile);
+
+    /**
+     * @brief Verifica assinatura, versão, tamanho e checksum de um perfil
+     * @param profile Perfil a verificar
+     * @return true se o perfil está íntegro
+     */
+    static bool isValidProfile(const PlayerProfile& profile);
+
+    /**
+     * @brief Grava o perfil binário em arquivo (uma única escrita)
+     * @param filename Caminho do arquivo (substituído se existir)
+     * @return true se o arquivo foi gravado
+     */
+    bool saveProfile(const std::string& filename) const;
+
+    /**
+     * @brief Carrega o perfil binário de um arquivo (uma única leitura)
+     * @param filename Caminho do arquivo
+     * @return true se o arquivo continha um perfil válido
+     */
+    bool loadProfile(const std::string& filename);
+
     /**
      * @brief Compara este jogador com outro para ranking
      * @param other Jogador para comparar
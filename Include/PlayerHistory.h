@@ -0,0 +1,268 @@
+/**
+ * @file PlayerHistory.h
+ * @brief Declaração da classe PlayerHistory - histórico tipado e compacto de eventos do jogador
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef PLAYER_HISTORY_H
+#define PLAYER_HISTORY_H
+
+#include <vector>
+#include <string>
+#include <map>
+#include <unordered_map>
+#include <memory>
+#include <fstream>
+#include <cstdint>
+
+/**
+ * @enum PlayerAction
+ * @brief Ações registradas no histórico do jogador
+ */
+enum class PlayerAction : uint8_t {
+    GAME_STARTED,        ///< Jogo iniciado (texto = nome do jogador)
+    INPUT_ADDED,         ///< Entrada registrada (texto = símbolo, valor 0 = posição)
+    SCORE_ADDED,         ///< Pontos somados (texto = motivo, valores = pontos, total, parâmetro do motivo)
+    LEVEL_ADVANCED,      ///< Nível avançado (valores = nível, pontos bônus)
+    LIFE_LOST,           ///< Vida perdida (texto = motivo, valor 0 = vidas restantes)
+    SEQUENCE_COMPLETED,  ///< Sequência concluída (valores = comprimento, sequência de acertos, pontos)
+    GAME_ENDED           ///< Jogo terminado (valores = pontuação, nível, duração em ms)
+};
+
+/**
+ * @struct PlayerEvent
+ * @brief Registro de tamanho fixo de um evento do jogador
+ */
+struct PlayerEvent {
+    int64_t timestamp;   ///< Instante do evento (ms do relógio monotônico)
+    uint32_t textId;     ///< Texto internado, motivo predefinido ou PlayerHistory::NO_TEXT
+    PlayerAction action; ///< Ação registrada
+    int32_t values[3];   ///< Valores inteiros da ação (ver PlayerAction)
+};
+
+/**
+ * @class PlayerHistory
+ * @brief Histórico de eventos em um buffer contíguo de registros fixos
+ *
+ * Cada evento ocupa um PlayerEvent; textos (símbolos, motivos, nomes) são
+ * internados uma única vez e referenciados por identificador, de modo que
+ * registrar um evento não aloca memória depois que o buffer e a tabela de
+ * textos se estabilizam. A forma antiga (um mapa de strings por evento) só
+ * é construída sob demanda por toMaps().
+ *
+ * Com uma capacidade definida, o buffer vira um anel que guarda apenas os
+ * eventos mais recentes. O registro completo pode ser gravado em um arquivo
+ * binário de acréscimo (spill), lido depois por loadSpillFile(). Cópias do
+ * histórico não herdam o arquivo.
+ */
+class PlayerHistory {
+public:
+    static const uint32_t NO_TEXT = 0xFFFFFFFFu;                ///< Evento sem texto
+    static const uint32_t REASON_SEQUENCE_COMPLETED = 0xFFFFFFFEu; ///< "Sequence completed (Length: N)"
+    static const uint32_t REASON_LEVEL_BONUS = 0xFFFFFFFDu;     ///< "Level N completion bonus"
+    static const uint32_t SPILL_MAGIC = 0x314C4850;             ///< "PHL1" em little-endian
+    static const uint16_t SPILL_VERSION = 1;                    ///< Versão do arquivo de spill
+
+private:
+    std::vector<PlayerEvent> events;                       ///< Eventos (anel quando há capacidade)
+    size_t head;                                           ///< Posição do evento mais antigo no anel
+    size_t capacity;                                       ///< Eventos mantidos em memória (0 = sem limite)
+    uint64_t totalRecorded;                                ///< Eventos registrados desde o último clear()
+    std::vector<std::string> texts;                        ///< Textos internados (índice = identificador)
+    std::unordered_map<std::string, uint32_t> textIds;     ///< Identificador de cada texto
+    std::unique_ptr<std::ofstream> spill;                  ///< Arquivo de spill (opcional)
+
+    /**
+     * @brief Acrescenta um evento ao anel (e ao arquivo de spill, se ativo)
+     */
+    void append(const PlayerEvent& event);
+
+    /**
+     * @brief Grava um evento no arquivo de spill
+     */
+    void spillEvent(const PlayerEvent& event);
+
+    /**
+     * @brief Grava a definição de um texto internado no arquivo de spill
+     */
+    void spillText(uint32_t id);
+
+    /**
+     * @brief Reorganiza o anel para que o evento mais antigo fique na posição 0
+     */
+    void linearize();
+
+public:
+    /**
+     * @brief Construtor padrão (histórico vazio e sem limite)
+     */
+    PlayerHistory();
+
+    /**
+     * @brief Construtor de cópia (a cópia não grava no arquivo de spill)
+     * @param other Objeto a ser copiado
+     */
+    PlayerHistory(const PlayerHistory& other);
+
+    /**
+     * @brief Construtor de movimentação (o arquivo de spill é transferido)
+     * @param other Objeto a ser movido
+     */
+    PlayerHistory(PlayerHistory&& other);
+
+    /**
+     * @brief Operador de atribuição (mantém o arquivo de spill deste objeto)
+     * @param other Objeto a ser atribuído
+     * @return Referência para este objeto
+     */
+    PlayerHistory& operator=(const PlayerHistory& other);
+
+    /**
+     * @brief Operador de atribuição por movimentação (o arquivo de spill é transferido)
+     * @param other Objeto a ser movido
+     * @return Referência para este objeto
+     */
+    PlayerHistory& operator=(PlayerHistory&& other);
+
+    /**
+     * @brief Interna um texto, reaproveitando o identificador se já existir
+     * @param text Texto a internar
+     * @return Identificador do texto
+     */
+    uint32_t intern(const std::string& text);
+
+    /**
+     * @brief Registra um evento
+     * @param action Ação registrada
+     * @param textId Identificador do texto associado (padrão: NO_TEXT)
+     * @param value0 Primeiro valor
+     * @param value1 Segundo valor
+     * @param value2 Terceiro valor
+     */
+    void record(PlayerAction action, uint32_t textId = NO_TEXT,
+                int32_t value0 = 0, int32_t value1 = 0, int32_t value2 = 0);
+
+    /**
+     * @brief Remove todos os eventos em memória (a memória e os textos internados são mantidos)
+     *
+     * O arquivo de spill não é truncado: o registro completo continua nele.
+     */
+    void clear();
+
+    /**
+     * @brief Define quantos eventos são mantidos em memória
+     *
+     * Ao reduzir a capacidade, apenas os eventos mais recentes são mantidos.
+     *
+     * @param newCapacity Número máximo de eventos (0 = sem limite)
+     */
+    void setCapacity(size_t newCapacity);
+
+    /**
+     * @brief Obtém a capacidade do histórico em memória
+     * @return Número máximo de eventos (0 = sem limite)
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief Obtém o número de eventos mantidos em memória
+     * @return Número de eventos disponíveis
+     */
+    size_t size() const;
+
+    /**
+     * @brief Verifica se o histórico está vazio
+     * @return true se não houver eventos
+     */
+    bool empty() const;
+
+    /**
+     * @brief Obtém o número de eventos registrados desde o último clear()
+     * @return Total de eventos, incluindo os descartados pelo anel
+     */
+    uint64_t getTotalRecorded() const;
+
+    /**
+     * @brief Obtém um evento em memória
+     * @param index Índice a partir do mais antigo (deve ser menor que size())
+     * @return Referência para o evento
+     */
+    const PlayerEvent& at(size_t index) const;
+
+    /**
+     * @brief Obtém os eventos em memória, do mais antigo ao mais recente
+     * @return Cópia dos eventos
+     */
+    std::vector<PlayerEvent> getEvents() const;
+
+    /**
+     * @brief Passa a gravar o registro completo em um arquivo binário de acréscimo
+     *
+     * Os textos internados e os eventos em memória são gravados primeiro, de
+     * modo que o arquivo seja autossuficiente.
+     *
+     * @param path Caminho do arquivo (criado se não existir)
+     * @return true se o arquivo foi aberto
+     */
+    bool enableSpill(const std::string& path);
+
+    /**
+     * @brief Encerra a gravação no arquivo de spill
+     */
+    void disableSpill();
+
+    /**
+     * @brief Verifica se os eventos estão sendo gravados em arquivo
+     * @return true se o spill estiver ativo e sem erros
+     */
+    bool isSpilling() const;
+
+    /**
+     * @brief Descarrega os eventos pendentes no arquivo de spill
+     */
+    void flush();
+
+    /**
+     * @brief Carrega o registro completo de um arquivo de spill
+     *
+     * Os eventos são acrescentados ao histórico informado (use um histórico
+     * sem limite para obter o registro inteiro). Um registro final incompleto
+     * (gravação interrompida) é ignorado.
+     *
+     * @param path Caminho do arquivo
+     * @param history Histórico que recebe os eventos
+     * @return true se o arquivo tem um cabeçalho válido
+     */
+    static bool loadSpillFile(const std::string& path, PlayerHistory& history);
+
+    /**
+     * @brief Obtém o texto de um evento, expandindo os motivos predefinidos
+     * @param event Evento consultado
+     * @return Texto do evento (vazio se não houver)
+     */
+    std::string textOf(const PlayerEvent& event) const;
+
+    /**
+     * @brief Obtém o nome textual de uma ação (ex.: "input_added")
+     * @param action Ação
+     * @return Nome usado na forma de mapa do histórico
+     */
+    static const char* actionName(PlayerAction action);
+
+    /**
+     * @brief Converte um evento para a forma de mapa de strings
+     * @param event Evento a converter
+     * @return Mapa com as mesmas chaves do histórico original
+     */
+    std::map<std::string, std::string> toMap(const PlayerEvent& event) const;
+
+    /**
+     * @brief Converte todo o histórico em memória para a forma de mapas de strings
+     * @return Vetor com um mapa por evento
+     */
+    std::vector<std::map<std::string, std::string>> toMaps() const;
+};
+
+#endif // PLAYER_HISTORY_H
@@ -0,0 +1,260 @@
+/**
+ * @file RandomEngines.h
+ * @brief Motores de números aleatórios intercambiáveis e redução de intervalo sem viés
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef RANDOM_ENGINES_H
+#define RANDOM_ENGINES_H
+
+#include "CounterRng.h"
+#include <cstdint>
+
+/*
+ * Todos os motores seguem a mesma política, usada como parâmetro de template
+ * por BasicSequenceGenerator:
+ *   - static constexpr bool COUNTER_BASED: saída é função pura do índice
+ *   - void seed(uint64_t seed, uint64_t stream): reinicia o fluxo
+ *   - uint32_t next32(): próximo valor de 32 bits do fluxo sequencial
+ */
+
+/**
+ * @class SplitMix64
+ * @brief Gerador SplitMix64 (8 bytes de estado), também usado para semear os demais
+ */
+class SplitMix64 {
+private:
+    uint64_t state;  ///< Estado (contador de Weyl)
+
+public:
+    static constexpr bool COUNTER_BASED = false;  ///< Motor sequencial
+
+    /**
+     * @brief Construtor da classe SplitMix64
+     * @param seedValue Semente inicial
+     */
+    explicit SplitMix64(uint64_t seedValue = 0) : state(seedValue) {}
+
+    /**
+     * @brief Reinicia o fluxo
+     * @param seedValue Semente
+     * @param stream Fluxo (sessão), misturado à semente
+     */
+    void seed(uint64_t seedValue, uint64_t stream = 0) {
+        state = seedValue ^ (stream * 0xD1B54A32D192ED03ULL);
+    }
+
+    /**
+     * @brief Gera o próximo valor de 64 bits
+     * @return Valor aleatório
+     */
+    uint64_t next64() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Gera o próximo valor de 32 bits (metade alta)
+     * @return Valor aleatório
+     */
+    uint32_t next32() {
+        return static_cast<uint32_t>(next64() >> 32);
+    }
+};
+
+/**
+ * @class Xoshiro256StarStar
+ * @brief Gerador xoshiro256** (32 bytes de estado, período 2^256 - 1)
+ */
+class Xoshiro256StarStar {
+private:
+    uint64_t state[4];  ///< Estado do gerador
+
+    static uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+public:
+    static constexpr bool COUNTER_BASED = false;  ///< Motor sequencial
+
+    /**
+     * @brief Construtor da classe Xoshiro256StarStar
+     * @param seedValue Semente inicial
+     */
+    explicit Xoshiro256StarStar(uint64_t seedValue = 0) {
+        seed(seedValue);
+    }
+
+    /**
+     * @brief Reinicia o fluxo, expandindo a semente com SplitMix64
+     * @param seedValue Semente
+     * @param stream Fluxo (sessão)
+     */
+    void seed(uint64_t seedValue, uint64_t stream = 0) {
+        SplitMix64 expander;
+        expander.seed(seedValue, stream);
+        for (uint64_t& word : state) {
+            word = expander.next64();
+        }
+    }
+
+    /**
+     * @brief Gera o próximo valor de 64 bits
+     * @return Valor aleatório
+     */
+    uint64_t next64() {
+        uint64_t result = rotl(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    /**
+     * @brief Gera o próximo valor de 32 bits (metade alta)
+     * @return Valor aleatório
+     */
+    uint32_t next32() {
+        return static_cast<uint32_t>(next64() >> 32);
+    }
+};
+
+/**
+ * @class Pcg32
+ * @brief Gerador PCG-XSH-RR 64/32 (16 bytes de estado, fluxos independentes)
+ */
+class Pcg32 {
+private:
+    uint64_t state;      ///< Estado do LCG
+    uint64_t increment;  ///< Incremento (ímpar), seleciona o fluxo
+
+public:
+    static constexpr bool COUNTER_BASED = false;  ///< Motor sequencial
+
+    /**
+     * @brief Construtor da classe Pcg32
+     * @param seedValue Semente inicial
+     * @param stream Fluxo inicial
+     */
+    explicit Pcg32(uint64_t seedValue = 0, uint64_t stream = 0) : state(0), increment(1) {
+        seed(seedValue, stream);
+    }
+
+    /**
+     * @brief Reinicia o fluxo (pcg32_srandom)
+     * @param seedValue Semente
+     * @param stream Fluxo (sessão)
+     */
+    void seed(uint64_t seedValue, uint64_t stream = 0) {
+        state = 0;
+        increment = (stream << 1) | 1u;
+        next32();
+        state += seedValue;
+        next32();
+    }
+
+    /**
+     * @brief Gera o próximo valor de 32 bits
+     * @return Valor aleatório
+     */
+    uint32_t next32() {
+        uint64_t old = state;
+        state = old * 6364136223846793005ULL + increment;
+        uint32_t xorshifted = static_cast<uint32_t>(((old >> 18) ^ old) >> 27);
+        uint32_t rot = static_cast<uint32_t>(old >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31));
+    }
+};
+
+/**
+ * @class PhiloxEngine
+ * @brief Adaptador do CounterRng (Philox4x32-10) para a política de motores
+ *
+ * Além do fluxo sequencial, oferece acesso direto por índice, o que permite
+ * saltos em O(1) e resultados idênticos aos de SequenceGenerator.
+ */
+class PhiloxEngine {
+private:
+    CounterRng rng;           ///< Gerador baseado em contador
+    CounterRng::Block block;  ///< Bloco corrente do fluxo sequencial
+    uint64_t counter;         ///< Próximo índice do fluxo sequencial
+    unsigned lane;            ///< Próxima palavra de block (4 = esgotado)
+
+public:
+    static constexpr bool COUNTER_BASED = true;  ///< Saída é função pura do índice
+
+    /**
+     * @brief Construtor da classe PhiloxEngine
+     * @param seedValue Semente inicial
+     * @param stream Sessão inicial
+     */
+    explicit PhiloxEngine(uint64_t seedValue = 0, uint64_t stream = 0)
+        : rng(seedValue, stream), block(), counter(0), lane(4) {}
+
+    /**
+     * @brief Reinicia o fluxo
+     * @param seedValue Semente
+     * @param stream Sessão
+     */
+    void seed(uint64_t seedValue, uint64_t stream = 0) {
+        rng.setSeed(seedValue);
+        rng.setSessionId(stream);
+        counter = 0;
+        lane = 4;
+    }
+
+    /**
+     * @brief Gera o próximo valor de 32 bits do fluxo sequencial
+     * @return Valor aleatório
+     */
+    uint32_t next32() {
+        if (lane == 4) {
+            block = rng.blockAt(counter++);
+            lane = 0;
+        }
+        return block[lane++];
+    }
+
+    /**
+     * @brief Obtém o gerador baseado em contador subjacente
+     * @return Referência para o CounterRng
+     */
+    const CounterRng& counterRng() const {
+        return rng;
+    }
+};
+
+/**
+ * @brief Sorteia um valor uniforme em [0, range) pelo método de Lemire
+ *
+ * Uma multiplicação 32x32->64 substitui a divisão; a divisão (módulo) só é
+ * calculada quando a parte baixa cai na zona de rejeição, o que é raro.
+ *
+ * @tparam Engine Motor com next32()
+ * @param engine Motor de números aleatórios
+ * @param range Tamanho do intervalo (deve ser maior que zero)
+ * @return Valor uniforme no intervalo, sem viés
+ */
+template <typename Engine>
+uint32_t boundedRandom(Engine& engine, uint32_t range) {
+    uint64_t product = static_cast<uint64_t>(engine.next32()) * range;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < range) {
+        uint32_t threshold = (0u - range) % range;
+        while (low < threshold) {
+            product = static_cast<uint64_t>(engine.next32()) * range;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+    return static_cast<uint32_t>(product >> 32);
+}
+
+#endif // RANDOM_ENGINES_H
@@ -0,0 +1,122 @@
+/**
+ * @file ReactionTimeStats.h
+ * @brief Declaração da classe ReactionTimeStats - estatísticas de tempo de reação em memória fixa
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef REACTION_TIME_STATS_H
+#define REACTION_TIME_STATS_H
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class ReactionTimeStats
+ * @brief Acumulador online de tempos de reação com média, variância e percentis
+ *
+ * Média e variância são mantidas pelo algoritmo de Welford. Os percentis vêm
+ * de um histograma log-linear no estilo HDR: os valores (em microssegundos)
+ * abaixo de 64 têm um balde cada; acima disso, cada potência de 2 é dividida
+ * em 32 baldes, o que limita o erro relativo a cerca de 3%. O histograma tem
+ * tamanho fixo, cobre até 2^36 µs (cerca de 19 horas) e acumuladores de
+ * jogadores diferentes podem ser combinados com merge().
+ */
+class ReactionTimeStats {
+public:
+    static const unsigned SUB_BUCKET_BITS = 5;      ///< log2 dos baldes por potência de 2
+    static const unsigned MAX_VALUE_BITS = 36;      ///< Valores registráveis: [0, 2^36) µs
+    static const size_t BUCKET_COUNT =
+        (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS;  ///< Número de baldes (1024)
+
+private:
+    uint64_t count;                 ///< Número de amostras
+    double mean;                    ///< Média (ms)
+    double m2;                      ///< Soma dos quadrados dos desvios (Welford)
+    double minValue;                ///< Menor amostra (ms)
+    double maxValue;                ///< Maior amostra (ms)
+    uint32_t buckets[BUCKET_COUNT]; ///< Histograma log-linear
+
+    /**
+     * @brief Obtém o balde de um valor
+     * @param micros Valor em microssegundos
+     * @return Índice do balde
+     */
+    static size_t bucketIndex(uint64_t micros);
+
+    /**
+     * @brief Obtém o valor representativo (ponto médio) de um balde
+     * @param index Índice do balde
+     * @return Valor em microssegundos
+     */
+    static double bucketMidpoint(size_t index);
+
+public:
+    /**
+     * @brief Construtor padrão (sem amostras)
+     */
+    ReactionTimeStats();
+
+    /**
+     * @brief Registra um tempo de reação
+     * @param milliseconds Tempo em milissegundos (negativos são tratados como 0)
+     */
+    void record(double milliseconds);
+
+    /**
+     * @brief Combina as amostras de outro acumulador com as deste
+     * @param other Acumulador a ser incorporado
+     */
+    void merge(const ReactionTimeStats& other);
+
+    /**
+     * @brief Remove todas as amostras
+     */
+    void clear();
+
+    /**
+     * @brief Obtém o número de amostras
+     * @return Número de tempos registrados
+     */
+    uint64_t getCount() const;
+
+    /**
+     * @brief Obtém a média
+     * @return Média em ms (0 sem amostras)
+     */
+    double getMean() const;
+
+    /**
+     * @brief Obtém a variância amostral
+     * @return Variância em ms² (0 com menos de duas amostras)
+     */
+    double getVariance() const;
+
+    /**
+     * @brief Obtém o desvio padrão amostral
+     * @return Desvio padrão em ms
+     */
+    double getStdDev() const;
+
+    /**
+     * @brief Obtém o menor tempo registrado
+     * @return Mínimo em ms (0 sem amostras)
+     */
+    double getMin() const;
+
+    /**
+     * @brief Obtém o maior tempo registrado
+     * @return Máximo em ms (0 sem amostras)
+     */
+    double getMax() const;
+
+    /**
+     * @brief Estima um percentil a partir do histograma
+     * @param percentile Percentil desejado, de 0 a 100 (ex.: 50, 90, 99)
+     * @return Valor estimado em ms, limitado a [mínimo, máximo] (0 sem amostras)
+     */
+    double getPercentile(double percentile) const;
+};
+
+#endif // REACTION_TIME_STATS_H
@@ -0,0 +1,218 @@
+/**
+ * @file ScoreArchive.h
+ * @brief Declaração da classe ScoreArchive - arquivo binário de pontuações com registros fixos
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef SCORE_ARCHIVE_H
+#define SCORE_ARCHIVE_H
+
+#include "ScoreEntry.h"
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct ScoreRecord
+ * @brief Registro binário de 64 bytes de uma pontuação
+ *
+ * A data não ocupa espaço no registro quando o timestamp a reproduz; datas
+ * em outro formato ou sem timestamp vão para a área de textos do arquivo.
+ */
+struct ScoreRecord {
+    static const size_t NAME_SIZE = 24;  ///< Bytes do nome, incluindo o terminador
+
+    char playerName[NAME_SIZE];  ///< Nome do jogador (terminado em '\0')
+    int32_t score;               ///< Pontuação
+    int32_t level;               ///< Nível alcançado
+    int64_t timestamp;           ///< Instante da pontuação (segundos desde a época Unix)
+    int64_t duration;            ///< Duração em milissegundos
+    double accuracy;             ///< Precisão (%)
+    int32_t streak;              ///< Sequência de acertos
+    uint32_t dateOffset;         ///< 1 + posição da data na área de textos (0: data obtida do timestamp)
+};
+
+/**
+ * @struct ScoreArchiveHeader
+ * @brief Cabeçalho de 32 bytes do arquivo binário de pontuações
+ */
+struct ScoreArchiveHeader {
+    uint32_t magic;        ///< ScoreArchive::MAGIC
+    uint16_t version;      ///< ScoreArchive::VERSION
+    uint16_t recordSize;   ///< sizeof(ScoreRecord)
+    uint32_t count;        ///< Número de registros
+    uint32_t checksum;     ///< FNV-1a do cabeçalho (com checksum zerado) e dos registros
+    uint64_t generation;   ///< Geração do snapshot (ver ScoreManager)
+    uint64_t textSize;     ///< Bytes da área de textos após os registros (zero na versão 1)
+};
+
+/**
+ * @class ScoreArchive
+ * @brief Visão somente leitura de um arquivo binário de pontuações
+ *
+ * O arquivo é um cabeçalho seguido de registros ScoreRecord contíguos, na
+ * representação nativa da plataforma, e de uma área de textos com as datas
+ * que o timestamp não reproduz (terminadas em '\0'). Em sistemas POSIX ele
+ * é mapeado com mmap, de modo que os registros podem ser consultados logo
+ * após open(), sem conversão de texto; nas demais plataformas o arquivo é
+ * lido de uma vez para a memória. Os registros permanecem válidos até
+ * close().
+ *
+ * A conversão de entradas preserva a data original: uma entrada lida de
+ * volta tem a mesma data efetiva (getEntryDate) e o mesmo timestamp. Os
+ * registros crus só guardam o timestamp; a data é formatada apenas quando
+ * getEntry() monta a entrada.
+ */
+class ScoreArchive {
+public:
+    static const uint32_t MAGIC = 0x31424353;  ///< "SCB1" em little-endian
+    static const uint16_t VERSION = 2;         ///< Versão do layout
+    static const uint16_t MIN_VERSION = 1;     ///< Versão mais antiga legível (sem área de textos)
+
+private:
+    const unsigned char* data;           ///< Início do arquivo em memória
+    size_t length;                       ///< Tamanho do arquivo em bytes
+    bool mapped;                         ///< true se data vem de mmap
+    std::vector<unsigned char> buffer;   ///< Cópia do arquivo quando não há mmap
+
+    /**
+     * @brief Obtém o cabeçalho do arquivo aberto
+     */
+    const ScoreArchiveHeader& header() const;
+
+    /**
+     * @brief Obtém o início da área de textos do arquivo aberto
+     */
+    const char* texts() const;
+
+public:
+    /**
+     * @brief Construtor padrão (nenhum arquivo aberto)
+     */
+    ScoreArchive();
+
+    /**
+     * @brief Destrutor (fecha o arquivo)
+     */
+    ~ScoreArchive();
+
+    ScoreArchive(const ScoreArchive&) = delete;
+    ScoreArchive& operator=(const ScoreArchive&) = delete;
+
+    /**
+     * @brief Abre um arquivo binário de pontuações
+     *
+     * Assinatura, versão, tamanho do registro e tamanho do arquivo são sempre
+     * conferidos; o checksum percorre todos os registros e pode ser dispensado
+     * quando o arquivo é confiável.
+     *
+     * @param path Caminho do arquivo
+     * @param verifyChecksum Se o checksum deve ser conferido
+     * @return true se o arquivo é um arquivo de pontuações válido
+     */
+    bool open(const std::string& path, bool verifyChecksum = true);
+
+    /**
+     * @brief Fecha o arquivo (os registros deixam de ser válidos)
+     */
+    void close();
+
+    /**
+     * @brief Verifica se há um arquivo aberto
+     * @return true se um arquivo válido está aberto
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Obtém o número de registros
+     * @return Registros no arquivo (0 se fechado)
+     */
+    size_t size() const;
+
+    /**
+     * @brief Obtém a geração gravada no cabeçalho
+     * @return Geração do snapshot (0 se fechado)
+     */
+    uint64_t getGeneration() const;
+
+    /**
+     * @brief Obtém os registros do arquivo
+     * @return Ponteiro para o primeiro registro (nullptr se fechado ou vazio)
+     */
+    const ScoreRecord* records() const;
+
+    /**
+     * @brief Obtém um registro
+     * @param index Índice do registro (deve ser menor que size())
+     * @return Referência para o registro
+     */
+    const ScoreRecord& operator[](size_t index) const;
+
+    /**
+     * @brief Converte um registro em entrada
+     *
+     * A data vem da área de textos ou, se o registro não a tem, é formatada a
+     * partir do timestamp, como nas entradas lidas do formato texto.
+     *
+     * @param index Índice do registro (deve ser menor que size())
+     * @return Entrada equivalente à gravada
+     */
+    ScoreEntry getEntry(size_t index) const;
+
+    /**
+     * @brief Grava um arquivo binário de pontuações com uma única escrita de registros
+     * @param path Caminho do arquivo (substituído se existir)
+     * @param records Registros a gravar
+     * @param texts Área de textos preenchida por toRecord
+     * @param generation Geração do snapshot
+     * @return true se o arquivo foi gravado
+     */
+    static bool write(const std::string& path, const std::vector<ScoreRecord>& records,
+                      const std::string& texts, uint64_t generation = 0);
+
+    /**
+     * @brief Verifica se um arquivo começa com a assinatura do formato binário
+     * @param path Caminho do arquivo
+     * @return true se o arquivo parece ser binário
+     */
+    static bool isArchiveFile(const std::string& path);
+
+    /**
+     * @brief Formata um instante como "dd/mm/aaaa hh:mm" (hora local)
+     * @param timestamp Segundos desde a época Unix
+     * @return Data formatada
+     */
+    static std::string formatTimestamp(int64_t timestamp);
+
+    /**
+     * @brief Converte uma data "dd/mm/aaaa hh:mm" (hora local) em instante
+     * @param date Data formatada
+     * @return Segundos desde a época Unix (0 se a data não estiver nesse formato)
+     */
+    static int64_t parseDate(const std::string& date);
+
+    /**
+     * @brief Obtém a data efetiva de uma entrada
+     * @param entry Entrada de pontuação
+     * @return A data da entrada ou, se vazia, o timestamp formatado (vazio se ambos faltam)
+     */
+    static std::string getEntryDate(const ScoreEntry& entry);
+
+    /**
+     * @brief Converte uma entrada em registro binário
+     *
+     * O timestamp é gravado como está. Uma data que o timestamp não reproduz
+     * (outro formato, como "Desconhecido", ou entrada sem timestamp) é
+     * acrescentada à área de textos.
+     *
+     * @param entry Entrada de pontuação
+     * @param texts Área de textos que recebe a data, se necessário
+     * @return Registro equivalente (nome truncado a NAME_SIZE - 1 bytes)
+     */
+    static ScoreRecord toRecord(const ScoreEntry& entry, std::string& texts);
+};
+
+#endif // SCORE_ARCHIVE_H
@@ -0,0 +1,52 @@
+/**
+ * @file ScoreEntry.h
+ * @brief Declaração da estrutura ScoreEntry - uma pontuação do leaderboard
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef SCORE_ENTRY_H
+#define SCORE_ENTRY_H
+
+#include <string>
+
+/**
+ * @struct ScoreEntry
+ * @brief Estrutura para representar uma entrada de pontuação
+ */
+struct ScoreEntry {
+    std::string playerName;     ///< Nome do jogador
+    int score;                  ///< Pontuação
+    int level;                  ///< Nível alcançado
+    std::string date;           ///< Data da pontuação
+    double accuracy;            ///< Precisão (%)
+    long long duration;         ///< Duração em milissegundos
+    int streak;                 ///< Sequência de acertos
+    long long timestamp;        ///< Instante da pontuação (segundos desde a época Unix, 0 se desconhecido)
+
+    /**
+     * @brief Construtor padrão
+     */
+    ScoreEntry() : score(0), level(1), accuracy(0.0), duration(0), streak(0), timestamp(0) {}
+
+    /**
+     * @brief Construtor com parâmetros
+     */
+    ScoreEntry(const std::string& name, int sc, int lv, const std::string& dt, 
+               double acc, long long dur, int str, long long ts = 0) 
+        : playerName(name), score(sc), level(lv), date(dt), 
+          accuracy(acc), duration(dur), streak(str), timestamp(ts) {}
+
+    /**
+     * @brief Operador de comparação para ordenação
+     */
+    bool operator>(const ScoreEntry& other) const {
+        if (score != other.score) return score > other.score;
+        if (level != other.level) return level > other.level;
+        if (streak != other.streak) return streak > other.streak;
+        return accuracy > other.accuracy;
+    }
+};
+
+#endif // SCORE_ENTRY_H
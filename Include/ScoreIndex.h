@@ -0,0 +1,164 @@
+/**
+ * @file ScoreIndex.h
+ * @brief Declaração da classe ScoreIndex - índice de estatísticas de ordem sobre pontuações
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef SCORE_INDEX_H
+#define SCORE_INDEX_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class ScoreIndex
+ * @brief Multiconjunto de pontuações com colocação, seleção e contagem em O(log n)
+ *
+ * É uma treap (árvore binária de busca com prioridades aleatórias) em que
+ * cada nó guarda um valor de pontuação distinto, quantas vezes ele ocorre e
+ * o total de ocorrências da subárvore. Com esses totais, colocação,
+ * seleção da k-ésima maior pontuação, contagem em um intervalo e percentil
+ * descem um único caminho da raiz. Os nós ficam em um vetor e nós removidos
+ * são reaproveitados, de modo que inserções não alocam um nó por vez.
+ */
+class ScoreIndex {
+private:
+    static const int32_t NIL = -1;  ///< Filho ausente
+
+    /**
+     * @struct Node
+     * @brief Nó da treap
+     */
+    struct Node {
+        int score;          ///< Valor da pontuação (chave)
+        uint32_t count;     ///< Ocorrências deste valor
+        uint32_t total;     ///< Ocorrências na subárvore
+        uint32_t priority;  ///< Prioridade aleatória (heap máximo)
+        int32_t left;       ///< Subárvore de valores menores
+        int32_t right;      ///< Subárvore de valores maiores
+    };
+
+    std::vector<Node> nodes;        ///< Reservatório de nós
+    std::vector<int32_t> freeNodes; ///< Nós removidos disponíveis para reuso
+    int32_t root;                   ///< Raiz da treap
+    uint32_t seed;                  ///< Estado do gerador de prioridades (xorshift32)
+
+    /**
+     * @brief Obtém o total de ocorrências de uma subárvore (0 para NIL)
+     */
+    uint32_t totalOf(int32_t node) const;
+
+    /**
+     * @brief Recalcula o total de um nó a partir dos filhos
+     */
+    void update(int32_t node);
+
+    /**
+     * @brief Rotação à direita (o filho esquerdo sobe)
+     */
+    int32_t rotateRight(int32_t node);
+
+    /**
+     * @brief Rotação à esquerda (o filho direito sobe)
+     */
+    int32_t rotateLeft(int32_t node);
+
+    /**
+     * @brief Cria um nó com uma ocorrência de score
+     */
+    int32_t allocateNode(int score);
+
+    /**
+     * @brief Insere uma ocorrência na subárvore
+     * @return Nova raiz da subárvore
+     */
+    int32_t insertAt(int32_t node, int score);
+
+    /**
+     * @brief Remove uma ocorrência da subárvore
+     * @return Nova raiz da subárvore
+     */
+    int32_t eraseAt(int32_t node, int score, bool& erased);
+
+public:
+    /**
+     * @brief Construtor padrão (índice vazio)
+     */
+    ScoreIndex();
+
+    /**
+     * @brief Acrescenta uma ocorrência de uma pontuação
+     * @param score Pontuação
+     */
+    void insert(int score);
+
+    /**
+     * @brief Remove uma ocorrência de uma pontuação
+     * @param score Pontuação
+     * @return true se havia uma ocorrência para remover
+     */
+    bool erase(int score);
+
+    /**
+     * @brief Remove todas as pontuações
+     */
+    void clear();
+
+    /**
+     * @brief Obtém o número de pontuações indexadas
+     * @return Total de ocorrências
+     */
+    size_t size() const;
+
+    /**
+     * @brief Conta as pontuações estritamente maiores que um valor
+     * @param score Valor de referência
+     * @return Número de pontuações maiores
+     */
+    size_t countAbove(int score) const;
+
+    /**
+     * @brief Conta as pontuações estritamente menores que um valor
+     * @param score Valor de referência
+     * @return Número de pontuações menores
+     */
+    size_t countBelow(int score) const;
+
+    /**
+     * @brief Conta as pontuações em um intervalo fechado
+     * @param low Limite inferior (inclusive)
+     * @param high Limite superior (inclusive)
+     * @return Número de pontuações em [low, high] (0 se low > high)
+     */
+    size_t countInRange(int low, int high) const;
+
+    /**
+     * @brief Obtém a melhor colocação que uma pontuação alcançaria
+     *
+     * Empates ficam à frente de uma pontuação nova, então a colocação real
+     * pode ser pior se houver pontuações iguais.
+     *
+     * @param score Pontuação
+     * @return 1 + número de pontuações estritamente maiores
+     */
+    size_t rank(int score) const;
+
+    /**
+     * @brief Obtém a k-ésima maior pontuação
+     * @param k Colocação (1 = maior pontuação), deve estar em [1, size()]
+     * @return Pontuação nessa colocação
+     */
+    int select(size_t k) const;
+
+    /**
+     * @brief Obtém o percentil de uma pontuação
+     * @param score Pontuação
+     * @return Porcentagem das pontuações indexadas que são menores (0 se vazio)
+     */
+    double percentile(int score) const;
+};
+
+#endif // SCORE_INDEX_H
@@ -14,42 +14,17 @@
 #include <map>
 #include <fstream>
 #include <chrono>
+#include <memory>
+#include <cstdint>
+#include "Leaderboard.h"
 
 /**
- * @struct ScoreEntry
- * @brief Estrutura para representar uma entrada de pontuação
+ * @enum ScoreFileFormat
+ * @brief Formato em que o snapshot de pontuações é gravado
  */
-struct ScoreEntry {
-    std::string playerName;     ///< Nome do jogador
-    int score;                  ///< Pontuação
-    int level;                  ///< Nível alcançado
-    std::string date;           ///< Data da pontuação
-    double accuracy;            ///< Precisão (%)
-    long long duration;         ///< Duração em milissegundos
-    int streak;                 ///< Sequência de acertos
-
-    /**
-     * @brief Construtor padrão
-     */
-    ScoreEntry() : score(0), level(1), accuracy(0.0), duration(0), streak(0) {}
-
-    /**
-     * @brief Construtor com parâmetros
-     */
-    ScoreEntry(const std::string& name, int sc, int lv, const std::string& dt, 
-               double acc, long long dur, int str) 
-        : playerName(name), score(sc), level(lv), date(dt), 
-          accuracy(acc), duration(dur), streak(str) {}
-
-    /**
-     * @brief Operador de comparação para ordenação
-     */
-    bool operator>(const ScoreEntry& other) const {
-        if (score != other.score) return score > other.score;
-        if (level != other.level) return level > other.level;
-        if (streak != other.streak) return streak > other.streak;
-        return accuracy > other.accuracy;
-    }
+enum class ScoreFileFormat {
+    TEXT,    ///< Linhas nome|pontuacao|nivel|data|precisao|duracao|sequencia|timestamp
+    BINARY   ///< Registros fixos de ScoreArchive (mapeados com mmap, sem conversão de texto)
 };
 
 /**
@@ -58,13 +33,33 @@ struct ScoreEntry {
  * 
  * Esta classe é responsável por armazenar, recuperar e gerenciar pontuações
  * usando persistência em arquivo, ordenação de leaderboard e validação de dados.
+ *
+ * Por padrão cada alteração regrava o arquivo inteiro. No modo de log
+ * (setLogMode) as alterações viram registros curtos acrescentados a
+ * "<arquivo>.log"; ao carregar, o ranking é reconstruído a partir do
+ * snapshot mais o log, e a cada compactionThreshold registros o log é
+ * incorporado a um novo snapshot. O snapshot guarda uma geração e o log
+ * só é aplicado se tiver a mesma geração, de modo que uma compactação
+ * interrompida nunca aplica o mesmo registro duas vezes.
+ *
+ * O snapshot pode ser gravado em texto ou no formato binário de ScoreArchive;
+ * ao carregar, o formato é detectado pela assinatura do arquivo. Importação
+ * e exportação continuam usando o formato de texto.
  */
 class ScoreManager {
+public:
+    static const size_t DEFAULT_COMPACTION_THRESHOLD = 256; ///< Registros no log antes da compactação
+
 private:
-    std::vector<ScoreEntry> scores;     ///< Lista de pontuações
-    size_t maxScores;                   ///< Número máximo de pontuações mantidas
+    Leaderboard scores;                 ///< Pontuações ordenadas (limitadas a getMaxScores())
     std::string filename;               ///< Nome do arquivo de persistência
     bool fileAvailable;                 ///< Indica se o arquivo está disponível
+    ScoreFileFormat fileFormat;         ///< Formato em que o snapshot é gravado
+    bool logMode;                       ///< Persistência por log de acréscimo ativa
+    size_t compactionThreshold;         ///< Registros no log que disparam a compactação
+    size_t logRecords;                  ///< Registros no log desde a última compactação
+    uint64_t generation;                ///< Geração do snapshot (o log só vale para a mesma geração)
+    std::unique_ptr<std::ofstream> logStream; ///< Log aberto para acréscimo (não é copiado)
 
     /**
      * @brief Verifica se o arquivo de pontuações está disponível
@@ -84,15 +79,78 @@ private:
     bool loadScores();
 
     /**
-     * @brief Salva pontuações no arquivo
+     * @brief Carrega o snapshot no formato de texto
+     * @param entries Recebe as entradas do arquivo, na ordem gravada
+     * @return true se carregou com sucesso
+     */
+    bool loadTextScores(std::vector<ScoreEntry>& entries);
+
+    /**
+     * @brief Carrega o snapshot no formato binário (ScoreArchive)
+     * @param entries Recebe as entradas do arquivo, na ordem gravada
+     * @return true se o arquivo era válido
+     */
+    bool loadBinaryScores(std::vector<ScoreEntry>& entries);
+
+    /**
+     * @brief Grava o snapshot no formato atual em um arquivo
+     * @param path Caminho do arquivo
+     * @param snapshotGeneration Geração gravada no snapshot
+     * @return true se gravou com sucesso
+     */
+    bool writeSnapshot(const std::string& path, uint64_t snapshotGeneration) const;
+
+    /**
+     * @brief Grava um novo snapshot (geração seguinte) e recomeça o log
      * @return true se salvou com sucesso
      */
     bool saveScores();
 
     /**
-     * @brief Ordena pontuações em ordem decrescente (maior primeiro)
+     * @brief Insere uma entrada mantendo a ordem e o limite de pontuações
+     * @param entry Entrada a inserir
+     * @return Colocação da entrada (1 = primeiro lugar) ou 0 se não se qualificou
+     */
+    size_t insertEntry(const ScoreEntry& entry);
+
+    /**
+     * @brief Remove as pontuações de um jogador (sem diferenciar maiúsculas)
+     * @param playerName Nome do jogador
+     * @return Número de pontuações removidas
+     */
+    int erasePlayerScores(const std::string& playerName);
+
+    /**
+     * @brief Persiste uma alteração (registro no log ou regravação completa)
+     * @param record Registro de log que descreve a alteração
+     * @return true se a alteração foi persistida
+     */
+    bool persist(const std::string& record);
+
+    /**
+     * @brief Acrescenta um registro ao log, compactando ao atingir o limite
+     * @param record Registro a acrescentar (sem quebra de linha)
+     * @return true se o registro foi gravado
+     */
+    bool appendLog(const std::string& record);
+
+    /**
+     * @brief Recomeça o log após um novo snapshot (ou o remove fora do modo de log)
+     * @return true se o log ficou consistente com o snapshot
+     */
+    bool resetLog();
+
+    /**
+     * @brief Aplica os registros do log da geração atual às pontuações carregadas
      */
-    void sortScores();
+    void replayLog();
+
+    /**
+     * @brief Aplica um registro do log
+     * @param record Linha do log
+     * @return true se o registro era válido
+     */
+    bool applyLogRecord(const std::string& record);
 
     /**
      * @brief Formata uma data para exibição
@@ -119,11 +177,13 @@ public:
      * @brief Construtor da classe ScoreManager
      * @param maxScores Número máximo de pontuações a manter (padrão: 10)
      * @param filename Nome do arquivo para persistência (padrão: "scores.dat")
+     * @param format Formato de gravação do snapshot (a leitura detecta o formato)
      */
-    explicit ScoreManager(size_t maxScores = 10, const std::string& filename = "scores.dat");
+    explicit ScoreManager(size_t maxScores = 10, const std::string& filename = "scores.dat",
+                          ScoreFileFormat format = ScoreFileFormat::TEXT);
 
     /**
-     * @brief Destrutor - salva automaticamente ao destruir
+     * @brief Destrutor - salva automaticamente ao destruir (no modo de log, apenas descarrega o log)
      */
     ~ScoreManager();
 
@@ -165,16 +225,17 @@ public:
     const ScoreEntry* getTopScore() const;
 
     /**
-     * @brief Obtém pontuações para um jogador específico
+     * @brief Obtém pontuações para um jogador específico (sem diferenciar maiúsculas)
      * @param playerName Nome do jogador
-     * @return Vetor de pontuações para o jogador
+     * @return Vetor de pontuações para o jogador, em ordem de colocação
      */
     std::vector<ScoreEntry> getPlayerScores(const std::string& playerName) const;
 
     /**
      * @brief Obtém a melhor pontuação do jogador
      * @param playerName Nome do jogador
-     * @return Ponteiro para a melhor pontuação do jogador ou nullptr
+     * @return Ponteiro para a melhor pontuação do jogador (válido até a próxima
+     *         alteração do leaderboard) ou nullptr
      */
     const ScoreEntry* getPlayerBestScore(const std::string& playerName) const;
 
@@ -185,6 +246,39 @@ public:
      */
     bool isQualifyingScore(int score) const;
 
+    /**
+     * @brief Obtém a colocação que uma pontuação alcançaria no leaderboard
+     *
+     * Consulta em O(log n) no índice de pontuações. Pontuações iguais já
+     * registradas ficam à frente, então o valor é a melhor colocação possível.
+     *
+     * @param score Pontuação a consultar
+     * @return 1 + número de pontuações estritamente maiores
+     */
+    size_t getRankForScore(int score) const;
+
+    /**
+     * @brief Obtém a pontuação de uma colocação
+     * @param rank Colocação (1 = primeiro lugar)
+     * @return Pontuação nessa colocação ou -1 se a colocação não existe
+     */
+    int getScoreAtRank(size_t rank) const;
+
+    /**
+     * @brief Conta as pontuações em um intervalo
+     * @param minScore Pontuação mínima (inclusive)
+     * @param maxScore Pontuação máxima (inclusive)
+     * @return Número de pontuações em [minScore, maxScore]
+     */
+    size_t countScoresInRange(int minScore, int maxScore) const;
+
+    /**
+     * @brief Obtém o percentil de uma pontuação no leaderboard
+     * @param score Pontuação a consultar
+     * @return Porcentagem (0 a 100) das pontuações registradas que são menores
+     */
+    double getPercentile(int score) const;
+
     /**
      * @brief Obtém estatísticas do leaderboard
      * @return Mapa com estatísticas sobre o leaderboard
@@ -267,6 +361,55 @@ public:
      * @return Número de pontuações
      */
     size_t getTotalScores() const;
+
+    /**
+     * @brief Obtém o formato de gravação do snapshot
+     * @return Formato atual
+     */
+    ScoreFileFormat getFileFormat() const;
+
+    /**
+     * @brief Altera o formato do snapshot e regrava o arquivo nele
+     * @param format Novo formato
+     * @return true se o snapshot foi gravado
+     */
+    bool setFileFormat(ScoreFileFormat format);
+
+    /**
+     * @brief Ativa ou desativa a persistência por log de acréscimo
+     *
+     * Nos dois sentidos um novo snapshot é gravado, para que o log comece
+     * vazio (ativação) ou deixe de existir (desativação).
+     *
+     * @param enabled true para acrescentar registros ao log em vez de regravar o arquivo
+     * @param compactionThreshold Registros acumulados que disparam a compactação (mínimo 1)
+     * @return true se o snapshot foi gravado
+     */
+    bool setLogMode(bool enabled, size_t compactionThreshold = DEFAULT_COMPACTION_THRESHOLD);
+
+    /**
+     * @brief Verifica se a persistência por log está ativa
+     * @return true se as alterações são acrescentadas ao log
+     */
+    bool isLogMode() const;
+
+    /**
+     * @brief Incorpora o log a um novo snapshot
+     * @return true se o snapshot foi gravado
+     */
+    bool compact();
+
+    /**
+     * @brief Obtém o número de registros no log desde o último snapshot
+     * @return Registros pendentes de compactação
+     */
+    size_t getLogRecordCount() const;
+
+    /**
+     * @brief Obtém o nome do arquivo de log
+     * @return Nome do arquivo de pontuações seguido de ".log"
+     */
+    std::string getLogFilename() const;
 };
 
 #endif // SCORE_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,130 @@
+/**
+ * @file SequenceBatch.h
+ * @brief Declaração da classe SequenceBatch - geração de sequências para muitas sessões
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef SEQUENCE_BATCH_H
+#define SEQUENCE_BATCH_H
+
+#include "SequenceGenerator.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+/**
+ * @class SequenceBatch
+ * @brief Estende as sequências de N sessões de uma só vez (layout estrutura de vetores)
+ *
+ * Os identificadores de sessão e os comprimentos ficam em vetores próprios, e
+ * os símbolos de cada sessão ocupam uma faixa fixa de maxSequenceLength bytes
+ * em um único buffer. extendAll() calcula o Philox de vários contadores por
+ * vez (CounterRng::philoxLanes) e produz exatamente os mesmos símbolos que um
+ * SequenceGenerator com a mesma semente e sessão, de modo que qualquer sessão
+ * pode ser convertida para um SequenceGenerator e continuar individualmente.
+ */
+class SequenceBatch {
+private:
+    std::vector<std::string> availableColors;  ///< Alfabeto comum a todas as sessões
+    CounterRng rng;                            ///< Gerador com a semente comum (sessão ignorada)
+    size_t maxSequenceLength;                  ///< Comprimento máximo (largura de cada faixa)
+    std::vector<uint64_t> sessionIds;          ///< Sessão de cada posição do lote
+    std::vector<uint32_t> lengths;             ///< Comprimento atual de cada sessão
+    std::vector<uint8_t> symbols;              ///< Símbolos, sessão a sessão (faixas de maxSequenceLength)
+
+public:
+    /**
+     * @brief Construtor da classe SequenceBatch
+     * @param colors Cores/símbolos disponíveis
+     * @param seed Semente comum a todas as sessões
+     * @param maxSequenceLength Comprimento máximo de cada sessão (padrão: 50)
+     * @throws std::invalid_argument se o alfabeto ou o comprimento forem inválidos
+     */
+    SequenceBatch(const std::vector<std::string>& colors, uint64_t seed,
+                  size_t maxSequenceLength = SequenceGenerator::DEFAULT_MAX_LENGTH);
+
+    /**
+     * @brief Adiciona uma sessão vazia ao lote
+     * @param sessionId Identificador da sessão
+     * @return Posição da sessão no lote
+     */
+    size_t addSession(uint64_t sessionId);
+
+    /**
+     * @brief Adiciona sessões consecutivas ao lote
+     * @param firstSessionId Identificador da primeira sessão
+     * @param count Número de sessões
+     * @return Posição da primeira sessão adicionada
+     */
+    size_t addSessions(uint64_t firstSessionId, size_t count);
+
+    /**
+     * @brief Adiciona o próximo elemento a todas as sessões que não atingiram o máximo
+     * @return Número de sessões estendidas
+     */
+    size_t extendAll();
+
+    /**
+     * @brief Remove todas as sessões
+     */
+    void clear();
+
+    /**
+     * @brief Obtém o número de sessões
+     * @return Número de sessões no lote
+     */
+    size_t size() const;
+
+    /**
+     * @brief Obtém o identificador de sessão de uma posição
+     * @param slot Posição no lote
+     * @return Identificador da sessão
+     */
+    uint64_t getSessionId(size_t slot) const;
+
+    /**
+     * @brief Obtém o comprimento da sequência de uma sessão
+     * @param slot Posição no lote
+     * @return Número de elementos
+     */
+    size_t getLength(size_t slot) const;
+
+    /**
+     * @brief Obtém um símbolo de uma sessão
+     * @param slot Posição no lote
+     * @param index Índice na sequência (deve ser menor que getLength(slot))
+     * @return Identificador do símbolo
+     */
+    uint8_t getSymbolId(size_t slot, size_t index) const;
+
+    /**
+     * @brief Obtém a faixa de símbolos de uma sessão
+     * @param slot Posição no lote
+     * @return Ponteiro para getLength(slot) identificadores
+     */
+    const uint8_t* getSessionSymbols(size_t slot) const;
+
+    /**
+     * @brief Obtém os comprimentos de todas as sessões
+     * @return Vetor de comprimentos
+     */
+    const std::vector<uint32_t>& getLengths() const;
+
+    /**
+     * @brief Obtém a semente comum
+     * @return Semente do lote
+     */
+    uint64_t getSeed() const;
+
+    /**
+     * @brief Cria um SequenceGenerator equivalente a uma sessão do lote
+     * @param slot Posição no lote
+     * @return Gerador com a mesma semente, sessão e sequência
+     * @throws std::out_of_range se a posição for inválida
+     */
+    SequenceGenerator toGenerator(size_t slot) const;
+};
+
+#endif // SEQUENCE_BATCH_H
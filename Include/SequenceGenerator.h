@@ -11,31 +11,96 @@
 
 #include <vector>
 #include <string>
-#include <random>
 #include <map>
+#include <cstdint>
+#include <memory>
+#include "PackedSequence.h"
+#include "CounterRng.h"
+#include "SymbolTable.h"
+
+/**
+ * @struct SequenceStats
+ * @brief Estatísticas da sequência atual, mantidas incrementalmente
+ */
+struct SequenceStats {
+    size_t length;           ///< Comprimento da sequência
+    size_t maxLength;        ///< Comprimento máximo permitido
+    int uniqueColors;        ///< Número de símbolos distintos presentes
+    int mostFrequentCount;   ///< Ocorrências do símbolo mais frequente (0 se vazia)
+    int leastFrequentCount;  ///< Ocorrências do símbolo presente menos frequente (0 se vazia)
+};
+
+/**
+ * @struct SequenceSnapshotHeader
+ * @brief Cabeçalho de layout fixo de um snapshot binário do SequenceGenerator
+ *
+ * O cabeçalho é seguido pelas contagens de cada símbolo (uint32_t, com
+ * preenchimento até múltiplo de 8 bytes) e pelas palavras empacotadas da
+ * sequência. Os campos usam a ordem de bytes da máquina; um magic invertido
+ * identifica snapshots de arquitetura incompatível.
+ */
+struct SequenceSnapshotHeader {
+    uint32_t magic;              ///< Identificador do formato (SNAPSHOT_MAGIC)
+    uint16_t version;            ///< Versão do formato
+    uint8_t bitsPerSymbol;       ///< Largura dos elementos empacotados (2, 4 ou 8)
+    uint8_t flags;               ///< Bit 0: armazenamento compactado ativo
+    uint64_t seed;               ///< Semente do gerador
+    uint64_t sessionId;          ///< Sessão do gerador
+    uint64_t alphabetId;         ///< Impressão digital (FNV-1a) do alfabeto
+    uint64_t length;             ///< Número de elementos da sequência
+    uint64_t maxSequenceLength;  ///< Comprimento máximo
+    uint64_t initialLength;      ///< Comprimento inicial
+    uint32_t alphabetSize;       ///< Número de símbolos do alfabeto
+    uint32_t reserved;           ///< Reservado (zero)
+    uint64_t checksum;           ///< Soma de verificação das contagens e palavras
+};
 
 /**
  * @class SequenceGenerator
  * @brief Responsável por gerar e gerenciar sequências aleatórias do jogo Simon
  * 
- * Esta classe encapsula a lógica de geração de sequências usando números aleatórios
- * criptograficamente seguros, validação de entrada do usuário e gerenciamento
- * da dificuldade progressiva do jogo.
+ * Esta classe encapsula a lógica de geração de sequências aleatórias, validação
+ * de entrada do usuário e gerenciamento da dificuldade progressiva do jogo.
+ *
+ * O elemento i de uma sessão é função pura de (semente, sessão, i), calculada
+ * por um gerador baseado em contador (CounterRng). A mesma semente reproduz a
+ * mesma sequência em qualquer máquina, e cópias não consultam o sistema.
+ *
+ * Internamente cada símbolo é identificado pelo seu índice no alfabeto
+ * (um byte), e a sequência é um vetor contíguo desses índices. Strings só são
+ * produzidas nas bordas da API (getCurrentSequence, getElementAt, toString).
+ * No modo de armazenamento compactado cada índice ocupa apenas 2 ou 4 bits,
+ * conforme o tamanho do alfabeto.
+ *
+ * O alfabeto é imutável e compartilhado entre cópias; trocar as cores cria
+ * um novo alfabeto. Assim, copiar ou clonar um gerador copia apenas as
+ * palavras da sequência, as contagens e o estado do gerador aleatório.
  */
 class SequenceGenerator {
+public:
+    static const size_t MAX_SYMBOLS = 255;       ///< Número máximo de símbolos no alfabeto
+    static const uint8_t INVALID_SYMBOL = 0xFF;  ///< Identificador de símbolo inexistente
+    static const size_t DEFAULT_MAX_LENGTH = 50; ///< Comprimento máximo padrão da sequência
+    static const uint32_t SNAPSHOT_MAGIC = 0x31534753;  ///< "SGS1" em little-endian
+    static const uint16_t SNAPSHOT_VERSION = 1;         ///< Versão atual do snapshot
+
 private:
-    std::vector<std::string> availableColors;  ///< Cores/símbolos disponíveis
-    std::vector<std::string> currentSequence;  ///< Sequência atual do jogo
+    std::shared_ptr<const SymbolTable> alphabet;  ///< Cores/símbolos disponíveis (compartilhado entre cópias)
+    PackedSequence currentSequence;            ///< Sequência atual do jogo (identificadores)
     size_t initialLength;                      ///< Comprimento inicial da sequência
     size_t maxSequenceLength;                  ///< Comprimento máximo permitido
-    std::mt19937 randomGenerator;              ///< Gerador de números aleatórios
-    std::uniform_int_distribution<int> distribution; ///< Distribuição uniforme
+    bool packedStorage;                        ///< Armazenamento compactado (2/4 bits por símbolo)
+    CounterRng rng;                            ///< Gerador baseado em contador (semente e sessão)
+    std::vector<uint32_t> symbolCounts;        ///< Ocorrências de cada símbolo na sequência
+    int uniqueSymbols;                         ///< Símbolos com pelo menos uma ocorrência
+    uint32_t maxSymbolCount;                   ///< Maior valor em symbolCounts
 
     /**
-     * @brief Valida os parâmetros do construtor
+     * @brief Valida os parâmetros do construtor e cria o alfabeto
+     * @param colors Cores/símbolos informados
      * @throws std::invalid_argument se os parâmetros forem inválidos
      */
-    void validateConstructorParams();
+    void validateConstructorParams(const std::vector<std::string>& colors);
 
     /**
      * @brief Inicializa a sequência com o comprimento inicial
@@ -43,20 +108,40 @@ private:
     void initializeSequence();
 
     /**
-     * @brief Gera um índice aleatório criptograficamente seguro
-     * @return Índice aleatório dentro do range de cores disponíveis
+     * @brief Esvazia a sequência e zera as contagens de símbolos
      */
-    int generateRandomIndex();
+    void clearSequence();
+
+    /**
+     * @brief Adiciona um identificador à sequência, atualizando as contagens
+     * @param symbolId Identificador do símbolo
+     */
+    void appendSymbol(uint8_t symbolId);
+
+    /**
+     * @brief Obtém a largura de elemento adequada ao modo de armazenamento atual
+     * @return Bits por símbolo
+     */
+    unsigned storageBitsPerSymbol() const;
 
 public:
+    /**
+     * @brief Verifica se um conjunto de cores é um alfabeto válido
+     * @param colors Cores a verificar
+     * @return true se não estiver vazio, não exceder MAX_SYMBOLS e não tiver duplicatas
+     */
+    static bool isValidAlphabet(const std::vector<std::string>& colors);
+
     /**
      * @brief Construtor da classe SequenceGenerator
      * @param colors Vetor de cores/símbolos disponíveis
      * @param initialLength Comprimento inicial da sequência (padrão: 1)
+     * @param maxSequenceLength Comprimento máximo da sequência (padrão: 50)
      * @throws std::invalid_argument se os parâmetros forem inválidos
      */
     explicit SequenceGenerator(const std::vector<std::string>& colors = {"A", "B", "C", "D"}, 
-                              size_t initialLength = 1);
+                              size_t initialLength = 1,
+                              size_t maxSequenceLength = DEFAULT_MAX_LENGTH);
 
     /**
      * @brief Destrutor virtual padrão
@@ -64,18 +149,46 @@ public:
     virtual ~SequenceGenerator() = default;
 
     /**
-     * @brief Construtor de cópia
+     * @brief Construtor de cópia (copia também a semente e a sessão)
      * @param other Objeto a ser copiado
      */
     SequenceGenerator(const SequenceGenerator& other);
 
     /**
-     * @brief Operador de atribuição
+     * @brief Construtor de movimentação
+     *
+     * Não lança exceções nem aloca memória, para que contêineres movam
+     * geradores ao crescer em vez de copiá-los.
+     *
+     * @param other Objeto a ser movido (fica com a sequência vazia até reset())
+     */
+    SequenceGenerator(SequenceGenerator&& other) noexcept;
+
+    /**
+     * @brief Operador de atribuição (reaproveita a memória já alocada)
      * @param other Objeto a ser atribuído
      * @return Referência para este objeto
      */
     SequenceGenerator& operator=(const SequenceGenerator& other);
 
+    /**
+     * @brief Operador de atribuição por movimentação
+     * @param other Objeto a ser movido (fica com a sequência vazia até reset())
+     * @return Referência para este objeto
+     */
+    SequenceGenerator& operator=(SequenceGenerator&& other) noexcept;
+
+    /**
+     * @brief Cria uma cópia independente com a mesma sequência, semente e sessão
+     *
+     * Não consulta o sistema nem copia strings: o alfabeto é compartilhado e
+     * a sequência é copiada palavra a palavra. Útil para dar a mesma
+     * sequência a vários jogadores a partir de um gerador modelo.
+     *
+     * @return Novo gerador, igual a este
+     */
+    SequenceGenerator clone() const;
+
     /**
      * @brief Adiciona um elemento aleatório à sequência atual
      * @return String com o elemento adicionado ou string vazia se falhar
@@ -102,10 +215,92 @@ public:
     std::string getElementAt(size_t index) const;
 
     /**
-     * @brief Reinicia a sequência para o estado inicial
+     * @brief Obtém o identificador do símbolo em uma posição da sequência
+     * @param index Índice do elemento desejado
+     * @return Identificador do símbolo ou INVALID_SYMBOL se o índice for inválido
+     */
+    uint8_t getSymbolIdAt(size_t index) const;
+
+    /**
+     * @brief Obtém o identificador de um símbolo do alfabeto
+     * @param symbol Nome do símbolo
+     * @return Identificador do símbolo ou INVALID_SYMBOL se não pertencer ao alfabeto
+     */
+    uint8_t findSymbolId(const std::string& symbol) const;
+
+    /**
+     * @brief Obtém o nome de um símbolo a partir do identificador
+     * @param id Identificador do símbolo (deve ser menor que o tamanho do alfabeto)
+     * @return Referência para o nome do símbolo
+     */
+    const std::string& getSymbolName(uint8_t id) const;
+
+    /**
+     * @brief Obtém a sequência atual como identificadores de símbolos
+     * @return Vetor com um identificador por elemento
+     */
+    std::vector<uint8_t> getSymbolIds() const;
+
+    /**
+     * @brief Obtém a representação interna (possivelmente compactada) da sequência
+     * @return Referência para a sequência empacotada
+     */
+    const PackedSequence& getPackedSequence() const;
+
+    /**
+     * @brief Ativa ou desativa o armazenamento compactado
+     *
+     * Com o modo ativado, cada símbolo ocupa 2 bits (até 4 símbolos), 4 bits
+     * (até 16) ou 8 bits (demais alfabetos). A sequência atual é preservada.
+     *
+     * @param enabled true para compactar a sequência
+     */
+    void setPackedStorage(bool enabled);
+
+    /**
+     * @brief Verifica se o armazenamento compactado está ativo
+     * @return true se a sequência estiver compactada
+     */
+    bool isPackedStorage() const;
+
+    /**
+     * @brief Reinicia a sequência, avançando para a próxima sessão
      */
     void reset();
 
+    /**
+     * @brief Define a semente e a sessão, regenerando a sequência inicial
+     *
+     * Geradores com o mesmo alfabeto, semente e sessão produzem exatamente a
+     * mesma sequência (ex.: desafio diário compartilhado entre servidores).
+     *
+     * @param seed Semente do gerador
+     * @param sessionId Identificador da sessão (padrão: 0)
+     */
+    void setSeed(uint64_t seed, uint64_t sessionId = 0);
+
+    /**
+     * @brief Obtém a semente atual
+     * @return Semente do gerador
+     */
+    uint64_t getSeed() const;
+
+    /**
+     * @brief Obtém a sessão atual
+     * @return Identificador da sessão
+     */
+    uint64_t getSessionId() const;
+
+    /**
+     * @brief Calcula o símbolo gerado para uma posição da sessão atual
+     *
+     * Não altera o estado: permite saltar para qualquer posição em O(1).
+     *
+     * @param index Posição na sequência
+     * @return Identificador do símbolo
+     */
+    uint8_t symbolIdForIndex(uint64_t index) const;
+
     /**
      * @brief Define uma sequência personalizada (útil para testes)
      * @param sequence Sequência personalizada
@@ -128,10 +323,27 @@ public:
 
     /**
      * @brief Gera uma prévia do próximo elemento (para dicas/ajuste de dificuldade)
-     * @return Cor aleatória das cores disponíveis
+     * @return Cor que addRandomElement() adicionará em seguida
      */
     std::string previewNextElement();
 
+    /**
+     * @brief Altera o comprimento máximo da sequência
+     *
+     * Sequências longas (modo de resistência) devem usar também o
+     * armazenamento compactado, que cresce em blocos sem realocação.
+     *
+     * @param maxLength Novo comprimento máximo
+     * @return true se alterado (falha se for menor que initialLength ou que a sequência atual)
+     */
+    bool setMaxSequenceLength(size_t maxLength);
+
+    /**
+     * @brief Obtém o comprimento máximo da sequência
+     * @return Comprimento máximo permitido
+     */
+    size_t getMaxSequenceLength() const;
+
     /**
      * @brief Verifica se a sequência atingiu o comprimento máximo
      * @return true se estiver no comprimento máximo
@@ -144,6 +356,22 @@ public:
      */
     std::map<std::string, int> getSequenceStats() const;
 
+    /**
+     * @brief Obtém as estatísticas da sequência sem alocação
+     *
+     * As contagens por símbolo são atualizadas a cada elemento adicionado,
+     * então o custo é proporcional ao tamanho do alfabeto, não da sequência.
+     *
+     * @return Estatísticas da sequência atual
+     */
+    SequenceStats getStats() const;
+
+    /**
+     * @brief Obtém o número de ocorrências de cada símbolo
+     * @return Vetor indexado pelo identificador do símbolo
+     */
+    const std::vector<uint32_t>& getSymbolCounts() const;
+
     /**
      * @brief Converte a sequência para representação em string
      * @param separator Separador entre elementos (padrão: ", ")
@@ -160,6 +388,81 @@ public:
     std::pair<bool, int> validateUserSequence(const std::vector<std::string>& userSequence, 
                                              int upToIndex = -1) const;
 
+    /**
+     * @brief Valida uma sequência de entrada já convertida em identificadores
+     * @param userSymbolIds Identificadores dos símbolos inseridos pelo usuário
+     * @param upToIndex Verifica apenas até este índice (para validação parcial)
+     * @return Par com status de sucesso e posição do erro (se houver)
+     */
+    std::pair<bool, int> validateUserSequence(const std::vector<uint8_t>& userSymbolIds,
+                                             int upToIndex = -1) const;
+
+    /**
+     * @brief Valida uma sequência de entrada empacotada (ex.: replays gravados)
+     *
+     * Quando a largura da entrada coincide com a do armazenamento, a comparação
+     * é feita palavra a palavra com SSE2/AVX2, cobrindo até 256 elementos por
+     * iteração no modo de 2 bits.
+     *
+     * @param userSequence Sequência empacotada inserida pelo usuário
+     * @param upToIndex Verifica apenas até este índice (para validação parcial)
+     * @return Par com status de sucesso e posição do erro (se houver)
+     */
+    std::pair<bool, int> validateUserSequence(const PackedSequence& userSequence,
+                                             int upToIndex = -1) const;
+
+    /**
+     * @brief Calcula a impressão digital (FNV-1a de 64 bits) do alfabeto atual
+     * @return Identificador do alfabeto
+     */
+    uint64_t getAlphabetId() const;
+
+    /**
+     * @brief Obtém o tamanho em bytes do snapshot do estado atual
+     * @return Tamanho do snapshot
+     */
+    size_t getSnapshotSize() const;
+
+    /**
+     * @brief Grava o snapshot binário em um buffer fornecido
+     * @param buffer Destino
+     * @param capacity Tamanho do destino em bytes
+     * @return Bytes gravados, ou 0 se o buffer for pequeno demais
+     */
+    size_t writeSnapshot(uint8_t* buffer, size_t capacity) const;
+
+    /**
+     * @brief Gera o snapshot binário do estado atual
+     *
+     * Inclui semente, sessão, limites, modo de armazenamento, contagens de
+     * símbolos e a sequência empacotada, mas não o alfabeto (apenas sua
+     * impressão digital): a restauração exige um gerador com o mesmo alfabeto.
+     *
+     * @return Bytes do snapshot
+     */
+    std::vector<uint8_t> snapshot() const;
+
+    /**
+     * @brief Restaura o estado a partir de um snapshot
+     *
+     * As palavras empacotadas são copiadas diretamente, sem regenerar a
+     * sequência; uma leitura dos elementos confere que todo identificador
+     * pertence ao alfabeto e que as contagens gravadas coincidem com eles.
+     * Em caso de falha o estado atual não é alterado.
+     *
+     * @param data Bytes do snapshot
+     * @param size Tamanho em bytes
+     * @return true se o snapshot for válido e compatível com o alfabeto atual
+     */
+    bool restore(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Restaura o estado a partir de um snapshot
+     * @param data Bytes do snapshot
+     * @return true se o snapshot for válido e compatível com o alfabeto atual
+     */
+    bool restore(const std::vector<uint8_t>& data);
+
     /**
      * @brief Operador de igualdade
      * @param other Outro objeto para comparação
@@ -0,0 +1,91 @@
+/**
+ * @file SequenceValidator.h
+ * @brief Declaração da classe SequenceValidator - validação incremental de entradas
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef SEQUENCE_VALIDATOR_H
+#define SEQUENCE_VALIDATOR_H
+
+#include "SequenceGenerator.h"
+#include <string>
+#include <cstdint>
+
+/**
+ * @enum ValidationResult
+ * @brief Resultado da validação de uma única entrada
+ */
+enum class ValidationResult {
+    CORRECT,    ///< Entrada correta, ainda faltam elementos
+    WRONG,      ///< Entrada incorreta (o cursor não avança)
+    COMPLETE    ///< Entrada correta que conclui a sequência
+};
+
+/**
+ * @class SequenceValidator
+ * @brief Cursor de validação associado a um SequenceGenerator
+ *
+ * Cada entrada é comparada apenas com o elemento esperado na posição do
+ * cursor, sem copiar a sequência nem reexaminar o prefixo, de modo que o
+ * custo por entrada é constante e não há alocação de memória. O gerador
+ * deve permanecer vivo enquanto o validador for usado.
+ */
+class SequenceValidator {
+private:
+    const SequenceGenerator* generator;  ///< Gerador com a sequência esperada (não possuído)
+    size_t cursor;                       ///< Posição da próxima entrada esperada
+
+public:
+    /**
+     * @brief Construtor da classe SequenceValidator
+     * @param generator Gerador cuja sequência será validada
+     */
+    explicit SequenceValidator(const SequenceGenerator& generator);
+
+    /**
+     * @brief Valida a próxima entrada pelo identificador do símbolo
+     * @param symbolId Identificador do símbolo informado
+     * @return Resultado da validação
+     */
+    ValidationResult advance(uint8_t symbolId);
+
+    /**
+     * @brief Valida a próxima entrada pelo nome do símbolo
+     * @param symbol Nome do símbolo informado
+     * @return Resultado da validação
+     */
+    ValidationResult advance(const std::string& symbol);
+
+    /**
+     * @brief Volta o cursor para o início da sequência
+     */
+    void reset();
+
+    /**
+     * @brief Obtém a posição atual do cursor
+     * @return Índice da próxima entrada esperada
+     */
+    size_t getPosition() const;
+
+    /**
+     * @brief Obtém o identificador do símbolo esperado
+     * @return Identificador esperado ou SequenceGenerator::INVALID_SYMBOL se completo
+     */
+    uint8_t getExpectedSymbolId() const;
+
+    /**
+     * @brief Obtém o nome do símbolo esperado
+     * @return Nome esperado ou string vazia se a sequência já foi completada
+     */
+    const std::string& getExpectedSymbol() const;
+
+    /**
+     * @brief Verifica se toda a sequência já foi informada
+     * @return true se o cursor chegou ao fim da sequência
+     */
+    bool isComplete() const;
+};
+
+#endif // SEQUENCE_VALIDATOR_H
@@ -0,0 +1,185 @@
+/**
+ * @file SessionArena.h
+ * @brief Declaração da classe SessionArena - alocador por região para os objetos de uma sessão de jogo
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef SESSION_ARENA_H
+#define SESSION_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @class SessionArena
+ * @brief Região de memória de alocação sequencial liberada de uma só vez
+ *
+ * As alocações apenas avançam um cursor dentro de blocos grandes; nada é
+ * devolvido individualmente. Objetos criados com create() têm o destrutor
+ * registrado e são destruídos em ordem inversa por release(), que em seguida
+ * rebobina a região. Se a sessão precisou de mais de um bloco, release()
+ * troca todos por um único bloco do tamanho total, de modo que sessões
+ * seguintes de tamanho parecido não chamam o alocador global.
+ */
+class SessionArena {
+public:
+    static const size_t DEFAULT_BLOCK_SIZE = 16 * 1024;  ///< Tamanho padrão de bloco (bytes)
+
+private:
+    /**
+     * @struct Block
+     * @brief Cabeçalho de um bloco (os dados vêm logo em seguida)
+     */
+    struct Block {
+        Block* previous;  ///< Bloco alocado anteriormente
+        size_t size;      ///< Bytes de dados do bloco
+    };
+
+    /**
+     * @struct Finalizer
+     * @brief Destrutor pendente de um objeto criado na arena
+     */
+    struct Finalizer {
+        void (*destroy)(void*);  ///< Função que chama o destrutor
+        void* object;            ///< Objeto a destruir
+        Finalizer* previous;     ///< Finalizador registrado anteriormente
+    };
+
+    Block* current;          ///< Bloco em uso (o mais recente)
+    char* cursor;            ///< Próximo byte livre do bloco atual
+    char* limit;             ///< Fim do bloco atual
+    Finalizer* finalizers;   ///< Pilha de destrutores pendentes
+    size_t blockSize;        ///< Tamanho mínimo de um bloco novo
+    size_t blockCount;       ///< Número de blocos alocados
+    size_t capacity;         ///< Soma dos tamanhos dos blocos
+    size_t bytesUsed;        ///< Bytes entregues desde o último release()
+    size_t objectCount;      ///< Objetos com destrutor pendente
+
+    /**
+     * @brief Aloca um novo bloco que comporte a requisição
+     */
+    void* allocateSlow(size_t size, size_t alignment);
+
+    /**
+     * @brief Acrescenta um bloco com pelo menos dataSize bytes de dados
+     */
+    void addBlock(size_t dataSize);
+
+    /**
+     * @brief Devolve todos os blocos ao alocador global
+     */
+    void freeBlocks();
+
+    /**
+     * @brief Chama os destrutores pendentes em ordem inversa de criação
+     */
+    void destroyObjects();
+
+    /**
+     * @brief Chama o destrutor de um objeto do tipo T
+     */
+    template<typename T>
+    static void destroyObject(void* object) {
+        static_cast<T*>(object)->~T();
+    }
+
+public:
+    /**
+     * @brief Construtor da classe SessionArena (nenhum bloco é alocado até o primeiro uso)
+     * @param blockSize Tamanho mínimo de cada bloco em bytes
+     */
+    explicit SessionArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    /**
+     * @brief Destrutor (destrói os objetos pendentes e libera os blocos)
+     */
+    ~SessionArena();
+
+    SessionArena(const SessionArena&) = delete;
+    SessionArena& operator=(const SessionArena&) = delete;
+
+    /**
+     * @brief Reserva memória não inicializada na arena
+     * @param size Número de bytes
+     * @param alignment Alinhamento exigido (potência de 2)
+     * @return Ponteiro válido até o próximo release()
+     */
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        size_t padding = (alignment - reinterpret_cast<uintptr_t>(cursor) % alignment) % alignment;
+        if (cursor != nullptr && size + padding <= static_cast<size_t>(limit - cursor)) {
+            void* result = cursor + padding;
+            cursor += padding + size;
+            bytesUsed += padding + size;
+            return result;
+        }
+        return allocateSlow(size, alignment);
+    }
+
+    /**
+     * @brief Constrói um objeto na arena
+     *
+     * O destrutor é chamado por release() (ou pelo destrutor da arena), na
+     * ordem inversa de criação. Tipos com destrutor trivial não são registrados.
+     *
+     * @param args Argumentos repassados ao construtor de T
+     * @return Ponteiro para o objeto, válido até o próximo release()
+     */
+    template<typename T, typename... Args>
+    T* create(Args&&... args) {
+        Finalizer* finalizer = nullptr;
+        if (!std::is_trivially_destructible<T>::value) {
+            // Registro reservado antes da construção: uma falha de alocação
+            // aqui não deixa um objeto construído sem destrutor pendente
+            finalizer = static_cast<Finalizer*>(allocate(sizeof(Finalizer), alignof(Finalizer)));
+        }
+
+        T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+        if (finalizer != nullptr) {
+            finalizer->destroy = &SessionArena::destroyObject<T>;
+            finalizer->object = object;
+            finalizer->previous = finalizers;
+            finalizers = finalizer;
+            objectCount++;
+        }
+        return object;
+    }
+
+    /**
+     * @brief Destrói os objetos criados e rebobina a arena
+     *
+     * Todos os ponteiros obtidos da arena deixam de ser válidos.
+     */
+    void release();
+
+    /**
+     * @brief Obtém os bytes entregues desde o último release()
+     * @return Bytes em uso, incluindo preenchimento de alinhamento
+     */
+    size_t getBytesUsed() const;
+
+    /**
+     * @brief Obtém a memória total reservada pelos blocos
+     * @return Capacidade em bytes
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief Obtém o número de blocos alocados
+     * @return Número de blocos
+     */
+    size_t getBlockCount() const;
+
+    /**
+     * @brief Obtém o número de objetos com destrutor pendente
+     * @return Número de objetos criados desde o último release()
+     */
+    size_t getObjectCount() const;
+};
+
+#endif // SESSION_ARENA_H
@@ -0,0 +1,193 @@
+/**
+ * @file SimonEngine.h
+ * @brief Declaração da classe SimonEngine - núcleo headless da lógica do jogo Simon
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef SIMON_ENGINE_H
+#define SIMON_ENGINE_H
+
+#include "SequenceGenerator.h"
+#include "Player.h"
+#include "ScoreManager.h"
+#include "SequenceValidator.h"
+#include <vector>
+#include <string>
+
+/**
+ * @enum EnginePhase
+ * @brief Fases possíveis do motor de jogo
+ */
+enum class EnginePhase {
+    IDLE,           ///< Nenhum jogo em andamento
+    WAITING_INPUT,  ///< Aguardando a próxima entrada do jogador
+    GAME_OVER,      ///< Jogo terminado por falta de vidas
+    GAME_COMPLETE   ///< Jogo terminado por atingir o comprimento máximo
+};
+
+/**
+ * @enum EngineEventType
+ * @brief Tipos de eventos emitidos pelo motor a cada transição
+ */
+enum class EngineEventType {
+    ROUND_STARTED,      ///< Nova rodada iniciada (position = comprimento da sequência)
+    ROUND_RESTARTED,    ///< Rodada repetida após erro (position = comprimento da sequência)
+    INPUT_CORRECT,      ///< Entrada correta (position = índice na sequência)
+    INPUT_WRONG,        ///< Entrada incorreta (position = índice na sequência)
+    LIFE_LOST,          ///< Vida perdida (value = vidas restantes)
+    SEQUENCE_COMPLETE,  ///< Sequência completa (position = comprimento, value = pontos ganhos)
+    GAME_OVER,          ///< Fim de jogo sem vidas (value = pontuação final)
+    GAME_COMPLETE,      ///< Todos os níveis completados (value = pontuação final)
+    SCORE_SAVED,        ///< Pontuação registrada no ranking (value = posição no ranking)
+    NEW_RECORD,         ///< A pontuação registrada é um novo recorde
+    SCORE_REJECTED      ///< O ranking recusou a pontuação
+};
+
+/**
+ * @struct EngineEvent
+ * @brief Evento produzido pelo motor para ser apresentado pela interface
+ */
+struct EngineEvent {
+    EngineEventType type;   ///< Tipo do evento
+    int position;           ///< Posição na sequência ou comprimento (depende do tipo)
+    int value;              ///< Valor associado (pontos, vidas ou posição no ranking)
+    std::string symbol;     ///< Símbolo informado pelo jogador (eventos de entrada)
+    std::string expected;   ///< Símbolo esperado (eventos de entrada)
+
+    /**
+     * @brief Construtor com parâmetros
+     */
+    EngineEvent(EngineEventType t, int pos, int val,
+                const std::string& sym, const std::string& exp)
+        : type(t), position(pos), value(val), symbol(sym), expected(exp) {}
+};
+
+/**
+ * @class SimonEngine
+ * @brief Máquina de estados pura do jogo Simon, sem E/S de console e sem pausas
+ *
+ * O motor coordena SequenceGenerator, Player e (opcionalmente) ScoreManager.
+ * Cada chamada processa uma transição completa e devolve os eventos gerados,
+ * que a interface (por exemplo, SimonGame) apresenta como quiser. O vetor de
+ * eventos é reutilizado entre chamadas e só é válido até a próxima chamada.
+ */
+class SimonEngine {
+private:
+    SequenceGenerator* sequenceGenerator;  ///< Gerador de sequências (não possuído)
+    Player* player;                        ///< Jogador atual (não possuído)
+    ScoreManager* scoreManager;            ///< Gerenciador de pontuações (opcional, não possuído)
+
+    EnginePhase phase;                     ///< Fase atual do motor
+    SequenceValidator validator;           ///< Cursor de validação da rodada atual
+    std::vector<EngineEvent> events;       ///< Eventos da última transição
+
+    /**
+     * @brief Registra um evento da transição atual
+     */
+    void emit(EngineEventType type, int position = 0, int value = 0,
+              const std::string& symbol = std::string(),
+              const std::string& expected = std::string());
+
+    /**
+     * @brief Estende a sequência e inicia uma nova rodada (ou conclui o jogo)
+     */
+    void startRound();
+
+    /**
+     * @brief Prepara a entrada do jogador para a sequência atual
+     * @param type Tipo de evento de rodada a emitir
+     */
+    void beginInput(EngineEventType type);
+
+    /**
+     * @brief Registra a conclusão da sequência atual
+     */
+    void completeSequence();
+
+    /**
+     * @brief Aplica a perda de uma vida e termina o jogo se necessário
+     * @param reason Motivo da penalidade
+     * @return true se o jogador ainda está vivo
+     */
+    bool applyPenalty(const std::string& reason);
+
+    /**
+     * @brief Termina o jogo e registra a pontuação
+     * @param type GAME_OVER ou GAME_COMPLETE
+     */
+    void finishGame(EngineEventType type);
+
+    /**
+     * @brief Registra a pontuação do jogador no ScoreManager, se houver
+     */
+    void recordScore();
+
+public:
+    /**
+     * @brief Construtor da classe SimonEngine
+     * @param generator Gerador de sequências a ser conduzido
+     * @param player Jogador da partida
+     * @param scoreManager Gerenciador de pontuações (nullptr desativa o ranking)
+     */
+    SimonEngine(SequenceGenerator& generator, Player& player,
+                ScoreManager* scoreManager = nullptr);
+
+    /**
+     * @brief Inicia um novo jogo
+     * @param playerName Nome do jogador (vazio mantém o nome atual)
+     * @return Eventos gerados (normalmente ROUND_STARTED)
+     */
+    const std::vector<EngineEvent>& startGame(const std::string& playerName = "");
+
+    /**
+     * @brief Processa uma entrada do jogador
+     * @param input Símbolo informado
+     * @return Eventos gerados (vazio se o motor não aguarda entrada)
+     */
+    const std::vector<EngineEvent>& step(const std::string& input);
+
+    /**
+     * @brief Revela a sequência ao jogador, aplicando a penalidade de uma vida
+     * @return Eventos gerados (LIFE_LOST e, se for o caso, GAME_OVER)
+     */
+    const std::vector<EngineEvent>& revealSequence();
+
+    /**
+     * @brief Registra manualmente a pontuação atual do jogador
+     * @return Eventos gerados (SCORE_SAVED, NEW_RECORD ou SCORE_REJECTED)
+     */
+    const std::vector<EngineEvent>& saveScore();
+
+    /**
+     * @brief Abandona o jogo atual sem registrar pontuação
+     */
+    void abandonGame();
+
+    /**
+     * @brief Obtém a fase atual do motor
+     * @return Fase atual
+     */
+    EnginePhase getPhase() const;
+
+    /**
+     * @brief Obtém o índice da próxima entrada esperada
+     * @return Índice na sequência atual
+     */
+    size_t getInputIndex() const;
+
+    /**
+     * @brief Verifica se o motor aguarda entrada do jogador
+     * @return true se estiver aguardando entrada
+     */
+    bool isWaitingInput() const;
+
+    /**
+     * @brief Verifica se o jogo terminou (game over ou vitória)
+     * @return true se o jogo terminou
+     */
+    bool isFinished() const;
+};
+
+#endif // SIMON_ENGINE_H
@@ -12,6 +12,8 @@
 #include "SequenceGenerator.h"
 #include "Player.h"
 #include "ScoreManager.h"
+#include "SimonEngine.h"
+#include "SymbolTable.h"
 #include <memory>
 #include <chrono>
 #include <iostream>
@@ -33,18 +35,19 @@ enum class GameState {
  * @class SimonGame
  * @brief Controlador principal do jogo que orquestra todos os componentes
  * 
- * Esta classe coordena a geração de sequências, entrada do jogador, pontuação
- * e interface do usuário, implementando toda a lógica de fluxo do jogo Simon.
+ * Esta classe é a interface de terminal do jogo: lê a entrada do usuário,
+ * apresenta sequências e resultados e delega toda a lógica de fluxo do jogo
+ * ao SimonEngine, que não faz E/S nem pausas.
  */
 class SimonGame {
 private:
     std::unique_ptr<SequenceGenerator> sequenceGenerator; ///< Gerador de sequências
     std::unique_ptr<Player> player;                       ///< Jogador atual
     std::unique_ptr<ScoreManager> scoreManager;           ///< Gerenciador de pontuações
+    std::unique_ptr<SimonEngine> engine;                  ///< Motor com a lógica do jogo
     
     GameState currentState;                               ///< Estado atual do jogo
     bool gameRunning;                                     ///< Indica se o jogo está rodando
-    int currentSequenceIndex;                             ///< Índice atual na sequência
     std::chrono::steady_clock::time_point inputStartTime; ///< Tempo de início da entrada
     
     // Configurações do jogo
@@ -83,35 +86,47 @@ private:
     void showSequenceToPlayer();
 
     /**
-     * @brief Aguarda entrada do jogador
+     * @brief Lê entradas do jogador enquanto o motor aguardar entrada
      */
     void waitForPlayerInput();
 
     /**
-     * @brief Processa entrada correta do jogador
+     * @brief Exibe as instruções de entrada da rodada atual
+     */
+    void displayInputPrompt();
+
+    /**
+     * @brief Apresenta os eventos produzidos pelo motor
+     * @param events Eventos da última transição do motor
+     */
+    void renderEvents(const std::vector<EngineEvent>& events);
+
+    /**
+     * @brief Apresenta uma entrada correta do jogador
      * @param input Entrada do jogador
      */
     void handleCorrectInput(const std::string& input);
 
     /**
-     * @brief Processa entrada incorreta do jogador
+     * @brief Apresenta uma entrada incorreta do jogador
      * @param input Entrada incorreta
      * @param expected Entrada esperada
      */
     void handleIncorrectInput(const std::string& input, const std::string& expected);
 
     /**
-     * @brief Manipula conclusão de uma sequência
+     * @brief Apresenta a conclusão de uma sequência e atualiza as análises
+     * @param pointsEarned Pontos ganhos na sequência
      */
-    void handleSequenceComplete();
+    void handleSequenceComplete(int pointsEarned);
 
     /**
-     * @brief Manipula fim de jogo (game over)
+     * @brief Apresenta o fim de jogo (game over)
      */
     void handleGameOver();
 
     /**
-     * @brief Manipula conclusão completa do jogo (vitória)
+     * @brief Apresenta a conclusão completa do jogo (vitória)
      */
     void handleGameComplete();
 
@@ -150,11 +165,11 @@ private:
     /**
      * @brief Obtém entrada do usuário com validação
      * @param prompt Mensagem para o usuário
-     * @param validInputs Entradas válidas aceitas
-     * @return Entrada válida do usuário
+     * @param validInputs Tabela de entradas válidas (sem distinção de maiúsculas)
+     * @return Entrada válida do usuário, na forma cadastrada na tabela
      */
     std::string getValidInput(const std::string& prompt, 
-                             const std::vector<std::string>& validInputs);
+                             const SymbolTable& validInputs);
 
 public:
     /**
@@ -0,0 +1,120 @@
+/**
+ * @file SymbolTable.h
+ * @brief Declaração da classe SymbolTable - tabela de símbolos com busca O(1)
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+
+/**
+ * @class SymbolTable
+ * @brief Associa símbolos a identificadores de um byte com busca em tempo constante
+ *
+ * Símbolos de um caractere (o caso comum: "A", "B", "1", "S") são resolvidos
+ * por uma tabela de 256 posições indexada pelo próprio byte; símbolos maiores
+ * ("SAIR", "REVELAR") usam uma tabela hash. No modo sem distinção de
+ * maiúsculas, letras ASCII são normalizadas para maiúsculas.
+ */
+class SymbolTable {
+public:
+    static const size_t MAX_SYMBOLS = 255;   ///< Número máximo de símbolos
+    static const uint8_t NOT_FOUND = 0xFF;   ///< Identificador de símbolo inexistente
+
+private:
+    std::vector<std::string> symbols;                       ///< Símbolos (índice = identificador)
+    uint8_t byteLookup[256];                                ///< Identificador de cada símbolo de um caractere
+    std::unordered_map<std::string, uint8_t> wideLookup;    ///< Identificador dos símbolos maiores
+    bool caseInsensitive;                                   ///< Ignorar maiúsculas/minúsculas
+
+    /**
+     * @brief Normaliza um caractere conforme o modo da tabela
+     */
+    unsigned char fold(unsigned char c) const;
+
+    /**
+     * @brief Normaliza um símbolo conforme o modo da tabela
+     */
+    std::string fold(const std::string& symbol) const;
+
+public:
+    /**
+     * @brief Construtor de tabela vazia
+     * @param caseInsensitive Ignorar maiúsculas/minúsculas (padrão: false)
+     */
+    explicit SymbolTable(bool caseInsensitive = false);
+
+    /**
+     * @brief Construtor a partir de uma lista de símbolos
+     * @param symbols Símbolos na ordem dos identificadores
+     * @param caseInsensitive Ignorar maiúsculas/minúsculas (padrão: false)
+     * @throws std::invalid_argument se houver duplicatas ou símbolos demais
+     */
+    explicit SymbolTable(const std::vector<std::string>& symbols, bool caseInsensitive = false);
+
+    /**
+     * @brief Substitui os símbolos da tabela
+     *
+     * Duplicatas são detectadas durante a inserção, em O(1) por símbolo.
+     *
+     * @param newSymbols Símbolos na ordem dos identificadores
+     * @return true se válidos; em caso de falha a tabela não é alterada
+     */
+    bool assign(const std::vector<std::string>& newSymbols);
+
+    /**
+     * @brief Busca o identificador de um símbolo
+     * @param symbol Símbolo procurado
+     * @return Identificador ou NOT_FOUND
+     */
+    uint8_t find(const std::string& symbol) const;
+
+    /**
+     * @brief Busca o identificador de um símbolo de um caractere
+     * @param symbol Caractere procurado
+     * @return Identificador ou NOT_FOUND
+     */
+    uint8_t find(char symbol) const;
+
+    /**
+     * @brief Verifica se um símbolo pertence à tabela
+     * @param symbol Símbolo procurado
+     * @return true se pertencer
+     */
+    bool contains(const std::string& symbol) const;
+
+    /**
+     * @brief Obtém o nome de um identificador
+     * @param id Identificador (deve ser menor que size())
+     * @return Referência para o símbolo
+     */
+    const std::string& name(uint8_t id) const;
+
+    /**
+     * @brief Obtém todos os símbolos
+     * @return Símbolos na ordem dos identificadores
+     */
+    const std::vector<std::string>& getSymbols() const;
+
+    /**
+     * @brief Obtém o número de símbolos
+     * @return Número de símbolos
+     */
+    size_t size() const;
+
+    /**
+     * @brief Verifica se uma lista de símbolos formaria uma tabela válida
+     * @param symbols Símbolos a verificar
+     * @return true se não houver duplicatas nem símbolos demais
+     */
+    static bool isValidSymbolSet(const std::vector<std::string>& symbols);
+};
+
+#endif // SYMBOL_TABLE_H
@@ -0,0 +1,162 @@
+/**
+ * @file bench_rng.cpp
+ * @brief Benchmark de vazão dos motores de números aleatórios e geradores de sequência
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ *
+ * Uso: bench_rng [elementos]   (padrão: 20000000)
+ */
+
+#include "RandomEngines.h"
+#include "BasicSequenceGenerator.h"
+#include "SequenceGenerator.h"
+#include "SequenceBatch.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+volatile uint32_t sink;  ///< Impede que o compilador descarte os resultados
+
+typedef CharAlphabet<'A', 'B', 'C', 'D', 'E'> AlphabetABCDE;
+
+/**
+ * @brief Mede o tempo de uma função e imprime elementos por segundo
+ */
+template <typename Function>
+void report(const char* name, size_t stateBytes, uint64_t elements, Function function) {
+    auto start = std::chrono::steady_clock::now();
+    uint64_t produced = function(elements);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("%-44s %6zu B %10.1f M elem/s\n", name, stateBytes, produced / seconds / 1e6);
+}
+
+/**
+ * @brief Vazão bruta de next32()
+ */
+template <typename Engine>
+uint64_t rawThroughput(uint64_t elements) {
+    Engine engine;
+    engine.seed(12345, 0);
+    uint32_t acc = 0;
+    for (uint64_t i = 0; i < elements; ++i) {
+        acc ^= engine.next32();
+    }
+    sink = acc;
+    return elements;
+}
+
+/**
+ * @brief Vazão de boundedRandom() para um intervalo que não é potência de 2
+ */
+template <typename Engine>
+uint64_t boundedThroughput(uint64_t elements) {
+    Engine engine;
+    engine.seed(12345, 0);
+    uint32_t acc = 0;
+    for (uint64_t i = 0; i < elements; ++i) {
+        acc += boundedRandom(engine, 5);
+    }
+    sink = acc;
+    return elements;
+}
+
+/**
+ * @brief Vazão de addRandomElement() no gerador especializado
+ */
+template <typename Alphabet, typename Engine>
+uint64_t generatorThroughput(uint64_t elements) {
+    BasicSequenceGenerator<Alphabet, Engine> generator(1, 1000000);
+    generator.setSeed(12345);
+    uint64_t produced = 0;
+    while (produced < elements) {
+        if (generator.addRandomElement() == '\0') {
+            generator.reset();
+        }
+        produced++;
+    }
+    sink = generator.getSymbolIdAt(0);
+    return produced;
+}
+
+/**
+ * @brief Vazão de addRandomElement() no gerador configurável em tempo de execução
+ */
+uint64_t runtimeGeneratorThroughput(uint64_t elements) {
+    SequenceGenerator generator({"A", "B", "C", "D"}, 1, 1000000);
+    generator.setPackedStorage(true);
+    uint64_t produced = 0;
+    while (produced < elements) {
+        if (generator.addRandomElement().empty()) {
+            generator.reset();
+        }
+        produced++;
+    }
+    sink = generator.getSymbolIdAt(0);
+    return produced;
+}
+
+/**
+ * @brief Vazão de SequenceBatch::extendAll() (Philox em lote)
+ */
+uint64_t batchThroughput(uint64_t elements) {
+    const size_t sessions = 100000;
+    SequenceBatch batch({"A", "B", "C", "D"}, 12345, 50);
+    batch.addSessions(0, sessions);
+    uint64_t produced = 0;
+    while (produced < elements) {
+        size_t extended = batch.extendAll();
+        if (extended == 0) {
+            batch.clear();
+            batch.addSessions(produced, sessions);
+            continue;
+        }
+        produced += extended;
+    }
+    return produced;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    uint64_t elements = 20000000;
+    if (argc > 1) {
+        elements = std::strtoull(argv[1], nullptr, 10);
+    }
+
+    std::printf("Benchmark de geradores (%llu elementos por teste)\n\n",
+                static_cast<unsigned long long>(elements));
+    std::printf("%-44s %8s %19s\n", "Teste", "Estado", "Vazão");
+
+    report("next32 SplitMix64", sizeof(SplitMix64), elements, rawThroughput<SplitMix64>);
+    report("next32 Xoshiro256StarStar", sizeof(Xoshiro256StarStar), elements, rawThroughput<Xoshiro256StarStar>);
+    report("next32 Pcg32", sizeof(Pcg32), elements, rawThroughput<Pcg32>);
+    report("next32 PhiloxEngine", sizeof(PhiloxEngine), elements, rawThroughput<PhiloxEngine>);
+
+    report("boundedRandom(5) SplitMix64", sizeof(SplitMix64), elements, boundedThroughput<SplitMix64>);
+    report("boundedRandom(5) Xoshiro256StarStar", sizeof(Xoshiro256StarStar), elements, boundedThroughput<Xoshiro256StarStar>);
+    report("boundedRandom(5) Pcg32", sizeof(Pcg32), elements, boundedThroughput<Pcg32>);
+    report("boundedRandom(5) PhiloxEngine", sizeof(PhiloxEngine), elements, boundedThroughput<PhiloxEngine>);
+
+    report("BasicSequenceGenerator<ABCD, SplitMix64>", sizeof(SplitMix64), elements,
+           generatorThroughput<AlphabetABCD, SplitMix64>);
+    report("BasicSequenceGenerator<ABCD, Xoshiro256**>", sizeof(Xoshiro256StarStar), elements,
+           generatorThroughput<AlphabetABCD, Xoshiro256StarStar>);
+    report("BasicSequenceGenerator<ABCD, Pcg32>", sizeof(Pcg32), elements,
+           generatorThroughput<AlphabetABCD, Pcg32>);
+    report("BasicSequenceGenerator<ABCD, Philox>", sizeof(PhiloxEngine), elements,
+           generatorThroughput<AlphabetABCD, PhiloxEngine>);
+    report("BasicSequenceGenerator<ABCDE, Pcg32>", sizeof(Pcg32), elements,
+           generatorThroughput<AlphabetABCDE, Pcg32>);
+    report("BasicSequenceGenerator<ABCDE, Philox>", sizeof(PhiloxEngine), elements,
+           generatorThroughput<AlphabetABCDE, PhiloxEngine>);
+    report("SequenceGenerator (Philox, compactado)", sizeof(CounterRng), elements,
+           runtimeGeneratorThroughput);
+    report("SequenceBatch::extendAll (Philox em lote)", sizeof(CounterRng), elements,
+           batchThroughput);
+
+    return 0;
+}
@@ -10,10 +10,22 @@ mkdir -p obj bin
 
 # Compilar arquivos fonte
 echo "Compilando arquivos fonte..."
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/CounterRng.cpp -o obj/CounterRng.o
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/PackedSequence.cpp -o obj/PackedSequence.o
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/SequenceBatch.cpp -o obj/SequenceBatch.o
 g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/SequenceGenerator.cpp -o obj/SequenceGenerator.o
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/SequenceValidator.cpp -o obj/SequenceValidator.o
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/Leaderboard.cpp -o obj/Leaderboard.o
 g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/Player.cpp -o obj/Player.o
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/PlayerHistory.cpp -o obj/PlayerHistory.o
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/ReactionTimeStats.cpp -o obj/ReactionTimeStats.o
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/ScoreArchive.cpp -o obj/ScoreArchive.o
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/ScoreIndex.cpp -o obj/ScoreIndex.o
 g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/ScoreManager.cpp -o obj/ScoreManager.o
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/SessionArena.cpp -o obj/SessionArena.o
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/SimonEngine.cpp -o obj/SimonEngine.o
 g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/SimonGame.cpp -o obj/SimonGame.o
+g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c src/SymbolTable.cpp -o obj/SymbolTable.o
 g++ -std=c++11 -Wall -Wextra -Wpedantic -O2 -Iinclude -c main.cpp -o obj/main.o
 
 # Linkar executável
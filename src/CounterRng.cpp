@@ -0,0 +1,113 @@
+/**
+ * @file CounterRng.cpp
+ * @brief Implementação da classe CounterRng
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "CounterRng.h"
+#include <random>
+
+namespace {
+
+const uint32_t PHILOX_M0 = 0xD2511F53u;  ///< Multiplicador da primeira metade
+const uint32_t PHILOX_M1 = 0xCD9E8D57u;  ///< Multiplicador da segunda metade
+const uint32_t PHILOX_W0 = 0x9E3779B9u;  ///< Incremento da chave (razão áurea)
+const uint32_t PHILOX_W1 = 0xBB67AE85u;  ///< Incremento da chave (raiz de 3)
+const int PHILOX_ROUNDS = 10;
+
+inline void philoxRound(CounterRng::Block& ctr, const CounterRng::Key& key) {
+    uint64_t product0 = static_cast<uint64_t>(PHILOX_M0) * ctr[0];
+    uint64_t product1 = static_cast<uint64_t>(PHILOX_M1) * ctr[2];
+    uint32_t hi0 = static_cast<uint32_t>(product0 >> 32);
+    uint32_t lo0 = static_cast<uint32_t>(product0);
+    uint32_t hi1 = static_cast<uint32_t>(product1 >> 32);
+    uint32_t lo1 = static_cast<uint32_t>(product1);
+
+    CounterRng::Block next = {{hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0}};
+    ctr = next;
+}
+
+} // namespace
+
+CounterRng::CounterRng(uint64_t seed, uint64_t sessionId)
+    : seed(seed), sessionId(sessionId) {
+}
+
+CounterRng::Block CounterRng::philox(Block counter, Key key) {
+    for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+        if (round > 0) {
+            key[0] += PHILOX_W0;
+            key[1] += PHILOX_W1;
+        }
+        philoxRound(counter, key);
+    }
+    return counter;
+}
+
+void CounterRng::philoxLanes(uint32_t* ctr0, uint32_t* ctr1, uint32_t* ctr2, uint32_t* ctr3,
+                             size_t count, Key key) {
+    for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+        if (round > 0) {
+            key[0] += PHILOX_W0;
+            key[1] += PHILOX_W1;
+        }
+        const uint32_t key0 = key[0];
+        const uint32_t key1 = key[1];
+        for (size_t lane = 0; lane < count; ++lane) {
+            uint64_t product0 = static_cast<uint64_t>(PHILOX_M0) * ctr0[lane];
+            uint64_t product1 = static_cast<uint64_t>(PHILOX_M1) * ctr2[lane];
+            uint32_t next0 = static_cast<uint32_t>(product1 >> 32) ^ ctr1[lane] ^ key0;
+            uint32_t next2 = static_cast<uint32_t>(product0 >> 32) ^ ctr3[lane] ^ key1;
+            ctr0[lane] = next0;
+            ctr1[lane] = static_cast<uint32_t>(product1);
+            ctr2[lane] = next2;
+            ctr3[lane] = static_cast<uint32_t>(product0);
+        }
+    }
+}
+
+CounterRng::Block CounterRng::blockAt(uint64_t index, uint32_t attempt) const {
+    Block counter = {{static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32),
+                      static_cast<uint32_t>(sessionId), static_cast<uint32_t>(sessionId >> 32)}};
+    // A tentativa altera a chave, gerando um fluxo independente para reamostragem
+    Key key = {{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) + attempt}};
+    return philox(counter, key);
+}
+
+uint32_t CounterRng::boundedAt(uint64_t index, uint32_t range) const {
+    // Limiar de rejeição de Lemire: 2^32 mod range
+    uint32_t threshold = (0u - range) % range;
+
+    for (uint32_t attempt = 0; ; ++attempt) {
+        Block block = blockAt(index, attempt);
+        for (uint32_t word : block) {
+            uint64_t product = static_cast<uint64_t>(word) * range;
+            if (static_cast<uint32_t>(product) >= threshold) {
+                return static_cast<uint32_t>(product >> 32);
+            }
+        }
+    }
+}
+
+void CounterRng::setSeed(uint64_t newSeed) {
+    seed = newSeed;
+}
+
+void CounterRng::setSessionId(uint64_t newSessionId) {
+    sessionId = newSessionId;
+}
+
+uint64_t CounterRng::getSeed() const {
+    return seed;
+}
+
+uint64_t CounterRng::getSessionId() const {
+    return sessionId;
+}
+
+uint64_t CounterRng::randomSeed() {
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) ^ device();
+}
@@ -0,0 +1,358 @@
+/**
+ * @file Leaderboard.cpp
+ * @brief Implementação da classe Leaderboard
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "Leaderboard.h"
+#include <algorithm>
+#include <cctype>
+#include <utility>
+
+const size_t Leaderboard::BLOCK_SIZE;
+
+namespace {
+
+/**
+ * @brief Ordem do ranking: a maior entrada primeiro
+ */
+bool ranksBefore(const ScoreEntry& a, const ScoreEntry& b) {
+    return a > b;
+}
+
+/**
+ * @brief Converte um caractere para minúscula
+ */
+char lowerChar(char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+/**
+ * @brief Compara um nome com um nome já normalizado, sem alocar
+ */
+bool matchesName(const std::string& playerName, const std::string& normalized) {
+    if (playerName.size() != normalized.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < playerName.size(); ++i) {
+        if (lowerChar(playerName[i]) != normalized[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool Leaderboard::RankKeyOrder::operator()(const RankKey& a, const RankKey& b) const {
+    if (a.score != b.score) return a.score > b.score;
+    if (a.level != b.level) return a.level > b.level;
+    if (a.streak != b.streak) return a.streak > b.streak;
+    if (a.accuracy != b.accuracy) return a.accuracy > b.accuracy;
+    return a.sequence < b.sequence;
+}
+
+Leaderboard::Leaderboard(size_t capacity)
+    : count(0), capacity(std::max(static_cast<size_t>(1), capacity)), nextSequence(0) {
+}
+
+size_t Leaderboard::size() const {
+    return count;
+}
+
+bool Leaderboard::empty() const {
+    return count == 0;
+}
+
+bool Leaderboard::full() const {
+    return count >= capacity;
+}
+
+size_t Leaderboard::getCapacity() const {
+    return capacity;
+}
+
+size_t Leaderboard::setCapacity(size_t newCapacity) {
+    size_t before = count;
+    capacity = std::max(static_cast<size_t>(1), newCapacity);
+    trim();
+    return before - count;
+}
+
+bool Leaderboard::qualifies(const ScoreEntry& entry) const {
+    return !full() || entry > back();
+}
+
+Leaderboard::RankKey Leaderboard::keyOf(const Slot& slot) {
+    RankKey key = {slot.entry.score, slot.entry.level, slot.entry.streak,
+                   slot.entry.accuracy, slot.sequence};
+    return key;
+}
+
+size_t Leaderboard::insert(const ScoreEntry& entry) {
+    if (!qualifies(entry)) {
+        return 0;
+    }
+
+    Slot slot = {entry, nextSequence++};
+    scoreIndex.insert(entry.score);
+    playerKeys[normalizeName(entry.playerName)].insert(keyOf(slot));
+
+    if (blocks.empty()) {
+        blocks.push_back(std::vector<Slot>(1, slot));
+        count = 1;
+        return 1;
+    }
+
+    // Primeiro bloco cujo último elemento fica atrás da entrada; se nenhum
+    // fica, a entrada vai para o fim do último bloco
+    auto target = std::partition_point(blocks.begin(), blocks.end(),
+                                       [&entry](const std::vector<Slot>& block) {
+        return !(entry > block.back().entry);
+    });
+    if (target == blocks.end()) {
+        --target;
+    }
+
+    size_t rank = 0;
+    for (auto it = blocks.begin(); it != target; ++it) {
+        rank += it->size();
+    }
+
+    // upper_bound: empates ficam depois das entradas já existentes (chegada maior)
+    auto position = std::upper_bound(target->begin(), target->end(), entry,
+                                     [](const ScoreEntry& value, const Slot& element) {
+        return value > element.entry;
+    });
+    rank += static_cast<size_t>(position - target->begin()) + 1;
+    target->insert(position, std::move(slot));
+    count++;
+
+    if (target->size() >= 2 * BLOCK_SIZE) {
+        std::vector<Slot> upper(std::make_move_iterator(target->begin() + BLOCK_SIZE),
+                                std::make_move_iterator(target->end()));
+        target->resize(BLOCK_SIZE);
+        blocks.insert(target + 1, std::move(upper));
+    }
+
+    trim();
+    return rank;
+}
+
+void Leaderboard::assign(std::vector<ScoreEntry> entries) {
+    std::stable_sort(entries.begin(), entries.end(), ranksBefore);
+    if (entries.size() > capacity) {
+        entries.resize(capacity);
+    }
+
+    blocks.clear();
+    count = entries.size();
+    for (size_t first = 0; first < entries.size(); first += BLOCK_SIZE) {
+        size_t last = std::min(first + BLOCK_SIZE, entries.size());
+        std::vector<Slot> block;
+        block.reserve(last - first);
+        for (size_t i = first; i < last; ++i) {
+            Slot slot = {std::move(entries[i]), nextSequence++};
+            block.push_back(std::move(slot));
+        }
+        blocks.push_back(std::move(block));
+    }
+    rebuildIndexes();
+}
+
+void Leaderboard::rebuildIndexes() {
+    scoreIndex.clear();
+    playerKeys.clear();
+    for (const auto& block : blocks) {
+        for (const auto& slot : block) {
+            scoreIndex.insert(slot.entry.score);
+            // Chaves chegam em ordem crescente: inserção no fim do conjunto
+            PlayerKeys& keys = playerKeys[normalizeName(slot.entry.playerName)];
+            keys.insert(keys.end(), keyOf(slot));
+        }
+    }
+}
+
+void Leaderboard::unindex(const Slot& slot) {
+    scoreIndex.erase(slot.entry.score);
+    auto found = playerKeys.find(normalizeName(slot.entry.playerName));
+    if (found == playerKeys.end()) {
+        return;
+    }
+    found->second.erase(keyOf(slot));
+    if (found->second.empty()) {
+        playerKeys.erase(found);
+    }
+}
+
+void Leaderboard::erase(size_t index) {
+    size_t block, offset;
+    locate(index, block, offset);
+    unindex(blocks[block][offset]);
+    blocks[block].erase(blocks[block].begin() + offset);
+    count--;
+
+    if (blocks[block].empty()) {
+        blocks.erase(blocks.begin() + block);
+    } else if (blocks[block].size() < BLOCK_SIZE / 2 && block + 1 < blocks.size() &&
+               blocks[block].size() + blocks[block + 1].size() < 2 * BLOCK_SIZE) {
+        // Junta blocos pequenos para que remoções não degradem a busca por bloco
+        std::vector<Slot>& next = blocks[block + 1];
+        blocks[block].insert(blocks[block].end(), std::make_move_iterator(next.begin()),
+                             std::make_move_iterator(next.end()));
+        blocks.erase(blocks.begin() + block + 1);
+    }
+}
+
+size_t Leaderboard::removePlayer(const std::string& playerName) {
+    std::string normalized = normalizeName(playerName);
+    auto found = playerKeys.find(normalized);
+    if (found == playerKeys.end()) {
+        return 0;
+    }
+
+    size_t removed = found->second.size();
+    for (const auto& key : found->second) {
+        scoreIndex.erase(key.score);
+    }
+    playerKeys.erase(found);
+
+    for (auto& block : blocks) {
+        block.erase(std::remove_if(block.begin(), block.end(), [&normalized](const Slot& slot) {
+            return matchesName(slot.entry.playerName, normalized);
+        }), block.end());
+    }
+    blocks.erase(std::remove_if(blocks.begin(), blocks.end(), [](const std::vector<Slot>& block) {
+        return block.empty();
+    }), blocks.end());
+    count -= removed;
+    return removed;
+}
+
+void Leaderboard::clear() {
+    blocks.clear();
+    scoreIndex.clear();
+    playerKeys.clear();
+    count = 0;
+}
+
+void Leaderboard::trim() {
+    while (count > capacity) {
+        size_t excess = count - capacity;
+        std::vector<Slot>& last = blocks.back();
+        size_t dropped = std::min(excess, last.size());
+        for (size_t i = last.size() - dropped; i < last.size(); ++i) {
+            unindex(last[i]);
+        }
+        if (dropped == last.size()) {
+            blocks.pop_back();
+        } else {
+            last.resize(last.size() - dropped);
+        }
+        count -= dropped;
+    }
+}
+
+void Leaderboard::locate(size_t index, size_t& block, size_t& offset) const {
+    block = 0;
+    offset = index;
+    while (offset >= blocks[block].size()) {
+        offset -= blocks[block].size();
+        block++;
+    }
+}
+
+const Leaderboard::Slot& Leaderboard::findSlot(const RankKey& key) const {
+    RankKeyOrder before;
+    auto block = std::partition_point(blocks.begin(), blocks.end(),
+                                      [&](const std::vector<Slot>& candidate) {
+        return before(keyOf(candidate.back()), key);
+    });
+    auto slot = std::lower_bound(block->begin(), block->end(), key,
+                                 [&](const Slot& candidate, const RankKey& value) {
+        return before(keyOf(candidate), value);
+    });
+    return *slot;
+}
+
+const ScoreEntry& Leaderboard::operator[](size_t index) const {
+    size_t block, offset;
+    locate(index, block, offset);
+    return blocks[block][offset].entry;
+}
+
+const ScoreEntry& Leaderboard::front() const {
+    return blocks.front().front().entry;
+}
+
+const ScoreEntry& Leaderboard::back() const {
+    return blocks.back().back().entry;
+}
+
+std::vector<ScoreEntry> Leaderboard::toVector(size_t limit) const {
+    std::vector<ScoreEntry> result;
+    result.reserve(std::min(limit, count));
+    for (const auto& block : blocks) {
+        for (const auto& slot : block) {
+            if (result.size() == limit) {
+                return result;
+            }
+            result.push_back(slot.entry);
+        }
+    }
+    return result;
+}
+
+std::vector<ScoreEntry> Leaderboard::toVector() const {
+    return toVector(count);
+}
+
+std::vector<ScoreEntry> Leaderboard::getPlayerEntries(const std::string& playerName) const {
+    std::vector<ScoreEntry> result;
+    auto found = playerKeys.find(normalizeName(playerName));
+    if (found != playerKeys.end()) {
+        result.reserve(found->second.size());
+        for (const auto& key : found->second) {
+            result.push_back(findSlot(key).entry);
+        }
+    }
+    return result;
+}
+
+const ScoreEntry* Leaderboard::findPlayerBest(const std::string& playerName) const {
+    auto found = playerKeys.find(normalizeName(playerName));
+    return found == playerKeys.end() ? nullptr : &findSlot(*found->second.begin()).entry;
+}
+
+size_t Leaderboard::getPlayerEntryCount(const std::string& playerName) const {
+    auto found = playerKeys.find(normalizeName(playerName));
+    return found == playerKeys.end() ? 0 : found->second.size();
+}
+
+size_t Leaderboard::getPlayerCount() const {
+    return playerKeys.size();
+}
+
+std::string Leaderboard::normalizeName(const std::string& playerName) {
+    std::string normalized = playerName;
+    std::transform(normalized.begin(), normalized.end(), normalized.begin(), lowerChar);
+    return normalized;
+}
+
+const ScoreIndex& Leaderboard::getIndex() const {
+    return scoreIndex;
+}
+
+size_t Leaderboard::getBlockCount() const {
+    return blocks.size();
+}
+
+Leaderboard::const_iterator Leaderboard::begin() const {
+    return const_iterator(&blocks, 0, 0);
+}
+
+Leaderboard::const_iterator Leaderboard::end() const {
+    return const_iterator(&blocks, blocks.size(), 0);
+}
@@ -0,0 +1,397 @@
+/**
+ * @file PackedSequence.cpp
+ * @brief Implementação da classe PackedSequence
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "PackedSequence.h"
+#include <algorithm>
+#include <utility>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define PACKED_SEQUENCE_SSE2 1
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+    #define PACKED_SEQUENCE_AVX2 1
+#endif
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+namespace {
+
+/**
+ * @brief Calcula floor(log2(value)) de um valor não nulo
+ */
+inline unsigned floorLog2(uint64_t value) {
+#if defined(__GNUC__)
+    return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    unsigned result = 0;
+    while (value >>= 1) {
+        result++;
+    }
+    return result;
+#endif
+}
+
+/**
+ * @brief Conta os zeros à direita de uma palavra não nula
+ */
+inline unsigned countTrailingZeros(uint64_t value) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    unsigned count = 0;
+    while ((value & 1) == 0) {
+        value >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+size_t firstMismatchWordScalar(const uint64_t* a, const uint64_t* b, size_t begin, size_t count) {
+    for (size_t i = begin; i < count; ++i) {
+        if (a[i] != b[i]) {
+            return i;
+        }
+    }
+    return count;
+}
+
+#ifdef PACKED_SEQUENCE_SSE2
+/**
+ * @brief Compara 2 palavras (128 bits) por iteração
+ */
+size_t firstMismatchWordSse2(const uint64_t* a, const uint64_t* b, size_t count) {
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        unsigned equalBytes = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+        if (equalBytes != 0xFFFFu) {
+            return i + countTrailingZeros(~equalBytes & 0xFFFFu) / 8;
+        }
+    }
+    return firstMismatchWordScalar(a, b, i, count);
+}
+#endif
+
+#ifdef PACKED_SEQUENCE_AVX2
+/**
+ * @brief Compara 8 palavras (2 x 256 bits) por iteração
+ */
+__attribute__((target("avx2")))
+size_t firstMismatchWordAvx2(const uint64_t* a, const uint64_t* b, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 4));
+        __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 4));
+        unsigned equal0 = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a0, b0)));
+        unsigned equal1 = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a1, b1)));
+        if ((equal0 & equal1) != 0xFFFFFFFFu) {
+            if (equal0 != 0xFFFFFFFFu) {
+                return i + countTrailingZeros(~equal0 & 0xFFFFFFFFu) / 8;
+            }
+            return i + 4 + countTrailingZeros(~equal1 & 0xFFFFFFFFu) / 8;
+        }
+    }
+    return firstMismatchWordScalar(a, b, i, count);
+}
+
+bool hasAvx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+#endif
+
+} // namespace
+
+const size_t PackedSequence::BASE_CHUNK_WORDS;
+
+PackedSequence::PackedSequence(unsigned bitsPerSymbol)
+    : length(0), bitsPerSymbol(8), wordShift(3), symbolMask(0xFF) {
+    if (bitsPerSymbol == 2 || bitsPerSymbol == 4) {
+        this->bitsPerSymbol = bitsPerSymbol;
+        wordShift = (bitsPerSymbol == 2) ? 5 : 4;
+        symbolMask = (1ULL << bitsPerSymbol) - 1;
+    }
+}
+
+PackedSequence::PackedSequence(const PackedSequence& other)
+    : length(other.length), bitsPerSymbol(other.bitsPerSymbol),
+      wordShift(other.wordShift), symbolMask(other.symbolMask) {
+    size_t remaining = other.usedWords();
+    for (size_t chunk = 0; remaining > 0; ++chunk) {
+        size_t capacity = chunkWords(chunk);
+        size_t count = std::min(capacity, remaining);
+        chunks.push_back(std::unique_ptr<uint64_t[]>(new uint64_t[capacity]));
+        std::copy(other.chunks[chunk].get(), other.chunks[chunk].get() + count, chunks[chunk].get());
+        remaining -= count;
+    }
+}
+
+PackedSequence::PackedSequence(PackedSequence&& other) noexcept
+    : chunks(std::move(other.chunks)), length(other.length), bitsPerSymbol(other.bitsPerSymbol),
+      wordShift(other.wordShift), symbolMask(other.symbolMask) {
+    other.chunks.clear();
+    other.length = 0;
+}
+
+PackedSequence& PackedSequence::operator=(const PackedSequence& other) {
+    if (this != &other) {
+        length = other.length;
+        bitsPerSymbol = other.bitsPerSymbol;
+        wordShift = other.wordShift;
+        symbolMask = other.symbolMask;
+
+        // Reaproveitar os blocos já alocados; só os que faltarem são criados
+        size_t remaining = other.usedWords();
+        for (size_t chunk = 0; remaining > 0; ++chunk) {
+            size_t capacity = chunkWords(chunk);
+            size_t count = std::min(capacity, remaining);
+            if (chunk == chunks.size()) {
+                chunks.push_back(std::unique_ptr<uint64_t[]>(new uint64_t[capacity]));
+            }
+            std::memcpy(chunks[chunk].get(), other.chunks[chunk].get(), count * sizeof(uint64_t));
+            remaining -= count;
+        }
+    }
+    return *this;
+}
+
+PackedSequence& PackedSequence::operator=(PackedSequence&& other) noexcept {
+    if (this != &other) {
+        chunks = std::move(other.chunks);
+        length = other.length;
+        bitsPerSymbol = other.bitsPerSymbol;
+        wordShift = other.wordShift;
+        symbolMask = other.symbolMask;
+        other.chunks.clear();
+        other.length = 0;
+    }
+    return *this;
+}
+
+size_t PackedSequence::chunkOf(size_t wordIndex, size_t& offset) {
+    // O bloco k começa na palavra BASE * (2^k - 1)
+    size_t chunk = floorLog2(wordIndex / BASE_CHUNK_WORDS + 1);
+    offset = wordIndex - BASE_CHUNK_WORDS * ((static_cast<size_t>(1) << chunk) - 1);
+    return chunk;
+}
+
+size_t PackedSequence::chunkWords(size_t chunk) {
+    return BASE_CHUNK_WORDS << chunk;
+}
+
+size_t PackedSequence::usedWords() const {
+    return (length + (static_cast<size_t>(1) << wordShift) - 1) >> wordShift;
+}
+
+uint64_t PackedSequence::wordAt(size_t wordIndex) const {
+    size_t offset;
+    size_t chunk = chunkOf(wordIndex, offset);
+    return chunks[chunk][offset];
+}
+
+unsigned PackedSequence::bitsForAlphabet(size_t alphabetSize) {
+    if (alphabetSize <= 4) {
+        return 2;
+    }
+    if (alphabetSize <= 16) {
+        return 4;
+    }
+    return 8;
+}
+
+void PackedSequence::push_back(uint8_t symbolId) {
+    size_t slot = length & ((1u << wordShift) - 1);
+    size_t offset;
+    size_t chunk = chunkOf(length >> wordShift, offset);
+
+    if (slot == 0) {
+        // Nova palavra: alocar o bloco se necessário e zerar conteúdo antigo
+        if (chunk == chunks.size()) {
+            chunks.push_back(std::unique_ptr<uint64_t[]>(new uint64_t[chunkWords(chunk)]));
+        }
+        chunks[chunk][offset] = 0;
+    }
+    chunks[chunk][offset] |= (static_cast<uint64_t>(symbolId) & symbolMask) << (slot * bitsPerSymbol);
+    length++;
+}
+
+uint8_t PackedSequence::get(size_t index) const {
+    size_t slot = index & ((1u << wordShift) - 1);
+    return static_cast<uint8_t>((wordAt(index >> wordShift) >> (slot * bitsPerSymbol)) & symbolMask);
+}
+
+void PackedSequence::assign(const std::vector<uint8_t>& symbolIds) {
+    clear();
+    for (uint8_t id : symbolIds) {
+        push_back(id);
+    }
+}
+
+std::vector<uint8_t> PackedSequence::toIds() const {
+    std::vector<uint8_t> ids;
+    ids.reserve(length);
+    for (size_t i = 0; i < length; ++i) {
+        ids.push_back(get(i));
+    }
+    return ids;
+}
+
+void PackedSequence::repack(unsigned newBitsPerSymbol) {
+    PackedSequence repacked(newBitsPerSymbol);
+    if (repacked.bitsPerSymbol == bitsPerSymbol) {
+        return;
+    }
+
+    for (size_t i = 0; i < length; ++i) {
+        repacked.push_back(get(i));
+    }
+    *this = std::move(repacked);
+}
+
+void PackedSequence::clear() {
+    length = 0;
+}
+
+size_t PackedSequence::size() const {
+    return length;
+}
+
+bool PackedSequence::empty() const {
+    return length == 0;
+}
+
+unsigned PackedSequence::getBitsPerSymbol() const {
+    return bitsPerSymbol;
+}
+
+size_t PackedSequence::getStorageBytes() const {
+    return usedWords() * sizeof(uint64_t);
+}
+
+size_t PackedSequence::exportWords(uint64_t* out) const {
+    size_t remaining = usedWords();
+    size_t copied = 0;
+    for (size_t chunk = 0; remaining > 0; ++chunk) {
+        size_t count = std::min(chunkWords(chunk), remaining);
+        std::memcpy(out + copied, chunks[chunk].get(), count * sizeof(uint64_t));
+        copied += count;
+        remaining -= count;
+    }
+    return copied;
+}
+
+void PackedSequence::importWords(const uint64_t* source, size_t newLength) {
+    length = newLength;
+    size_t remaining = usedWords();
+    size_t copied = 0;
+    for (size_t chunk = 0; remaining > 0; ++chunk) {
+        size_t capacity = chunkWords(chunk);
+        size_t count = std::min(capacity, remaining);
+        if (chunk == chunks.size()) {
+            chunks.push_back(std::unique_ptr<uint64_t[]>(new uint64_t[capacity]));
+        }
+        std::memcpy(chunks[chunk].get(), source + copied, count * sizeof(uint64_t));
+        copied += count;
+        remaining -= count;
+    }
+
+    // Manter zerados os bits após o último elemento
+    size_t tail = length & ((1u << wordShift) - 1);
+    if (tail != 0) {
+        size_t offset;
+        size_t chunk = chunkOf(length >> wordShift, offset);
+        chunks[chunk][offset] &= (1ULL << (tail * bitsPerSymbol)) - 1;
+    }
+}
+
+size_t PackedSequence::getAllocatedBytes() const {
+    return BASE_CHUNK_WORDS * ((static_cast<size_t>(1) << chunks.size()) - 1) * sizeof(uint64_t);
+}
+
+size_t PackedSequence::firstMismatchWord(const uint64_t* a, const uint64_t* b, size_t count) {
+#ifdef PACKED_SEQUENCE_AVX2
+    if (hasAvx2()) {
+        return firstMismatchWordAvx2(a, b, count);
+    }
+#endif
+#ifdef PACKED_SEQUENCE_SSE2
+    return firstMismatchWordSse2(a, b, count);
+#else
+    return firstMismatchWordScalar(a, b, 0, count);
+#endif
+}
+
+size_t PackedSequence::firstMismatch(const PackedSequence& a, const PackedSequence& b, size_t count) {
+    size_t n = std::min(count, std::min(a.length, b.length));
+
+    // Larguras diferentes: comparar elemento a elemento
+    if (a.bitsPerSymbol != b.bitsPerSymbol) {
+        for (size_t i = 0; i < n; ++i) {
+            if (a.get(i) != b.get(i)) {
+                return i;
+            }
+        }
+        return n;
+    }
+
+    // Mesma largura implica a mesma geometria de blocos: comparar bloco a bloco
+    size_t fullWords = n >> a.wordShift;
+    size_t word = 0;
+    for (size_t chunk = 0; word < fullWords; ++chunk) {
+        size_t count = std::min(chunkWords(chunk), fullWords - word);
+        size_t local = firstMismatchWord(a.chunks[chunk].get(), b.chunks[chunk].get(), count);
+        word += local;
+        if (local < count) {
+            break;
+        }
+    }
+    uint64_t diff = 0;
+
+    if (word < fullWords) {
+        diff = a.wordAt(word) ^ b.wordAt(word);
+    } else {
+        // Última palavra parcial: considerar apenas os elementos dentro de n
+        size_t remaining = n & ((1u << a.wordShift) - 1);
+        if (remaining == 0) {
+            return n;
+        }
+        uint64_t mask = (1ULL << (remaining * a.bitsPerSymbol)) - 1;
+        diff = (a.wordAt(word) ^ b.wordAt(word)) & mask;
+        if (diff == 0) {
+            return n;
+        }
+    }
+
+    return (word << a.wordShift) + countTrailingZeros(diff) / a.bitsPerSymbol;
+}
+
+bool PackedSequence::operator==(const PackedSequence& other) const {
+    return length == other.length && firstMismatch(*this, other, length) == length;
+}
+
+bool PackedSequence::operator!=(const PackedSequence& other) const {
+    return !(*this == other);
+}
@@ -11,13 +11,69 @@
 #include <sstream>
 #include <iomanip>
 #include <stdexcept>
+#include <climits>
+#include <cstring>
+#include <cstddef>
+#include <fstream>
+#include <type_traits>
+
+static_assert(sizeof(PlayerHotState) <= 64, "PlayerHotState deve caber em uma linha de cache");
+static_assert(!std::is_polymorphic<Player>::value, "Player não deve ter vtable antes do estado quente");
+static_assert(std::is_standard_layout<PlayerProfile>::value &&
+              std::is_trivially_copyable<PlayerProfile>::value,
+              "PlayerProfile deve ser copiável byte a byte");
+static_assert(sizeof(PlayerProfile) == 4232, "Mudanças no layout de PlayerProfile exigem nova VERSION");
+
+// O checksum cobre os bytes crus do perfil: cada campo deve começar onde o
+// anterior termina, inclusive dentro de ReactionTimeStats
+static_assert(offsetof(PlayerProfile, name) == 8 &&
+              offsetof(PlayerProfile, score) == 8 + PlayerProfile::NAME_SIZE &&
+              offsetof(PlayerProfile, gameDuration) == offsetof(PlayerProfile, score) + 8 * sizeof(int32_t) &&
+              offsetof(PlayerProfile, savedAt) == offsetof(PlayerProfile, gameDuration) + sizeof(int64_t) &&
+              offsetof(PlayerProfile, averageReactionTime) == offsetof(PlayerProfile, savedAt) + sizeof(int64_t) &&
+              offsetof(PlayerProfile, reactionStats) == offsetof(PlayerProfile, averageReactionTime) + sizeof(double) &&
+              offsetof(PlayerProfile, checksum) == offsetof(PlayerProfile, reactionStats) + sizeof(ReactionTimeStats) &&
+              offsetof(PlayerProfile, reserved) == offsetof(PlayerProfile, checksum) + sizeof(uint32_t) &&
+              sizeof(PlayerProfile) == offsetof(PlayerProfile, reserved) + sizeof(uint32_t),
+              "PlayerProfile não pode ter bytes de preenchimento");
+static_assert(sizeof(ReactionTimeStats) ==
+              sizeof(uint64_t) + 4 * sizeof(double) + ReactionTimeStats::BUCKET_COUNT * sizeof(uint32_t),
+              "ReactionTimeStats não pode ter bytes de preenchimento");
+
+const uint32_t PlayerProfile::MAGIC;
+const uint16_t PlayerProfile::VERSION;
+const size_t PlayerProfile::NAME_SIZE;
+
+namespace {
 
-Player::Player(const std::string& name, int lives)
-    : maxLives(std::max(1, lives)), currentLives(maxLives), score(0), level(1),
-      totalCorrectSequences(0), totalWrongAttempts(0), bestStreak(0), currentStreak(0),
-      averageReactionTime(0.0) {
+/**
+ * @brief Calcula o FNV-1a de 32 bits dos bytes anteriores ao checksum
+ */
+uint32_t profileChecksum(const PlayerProfile& profile) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&profile);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(PlayerProfile, checksum); ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+} // namespace
+
+Player::Player(const std::string& name, int lives) : cold(new PlayerColdState()) {
+    hot.maxLives = std::max(1, lives);
+    hot.currentLives = hot.maxLives;
+    hot.score = 0;
+    hot.level = 1;
+    hot.totalCorrectSequences = 0;
+    hot.totalWrongAttempts = 0;
+    hot.bestStreak = 0;
+    hot.currentStreak = 0;
+    hot.gameStartTime = std::chrono::steady_clock::time_point{};
+    hot.gameEndTime = std::chrono::steady_clock::time_point{};
+    cold->averageReactionTime = 0.0;
     
-    this->name = validateAndSetName(name);
+    cold->name = validateAndSetName(name);
     initializePlayerState();
 }
 
@@ -51,58 +107,60 @@ std::string Player::validateAndSetName(const std::string& name) {
 }
 
 void Player::initializePlayerState() {
-    gameHistory.clear();
-    reactionTimes.clear();
-    lastInputTime = std::chrono::steady_clock::now();
+    cold->gameHistory.clear();
+    cold->reactionStats.clear();
+    hot.lastInputTime = std::chrono::steady_clock::now();
 }
 
 Player::Player(const Player& other)
-    : name(other.name), maxLives(other.maxLives), currentLives(other.currentLives),
-      score(other.score), level(other.level), currentInputSequence(other.currentInputSequence),
-      totalCorrectSequences(other.totalCorrectSequences), totalWrongAttempts(other.totalWrongAttempts),
-      gameStartTime(other.gameStartTime), gameEndTime(other.gameEndTime),
-      bestStreak(other.bestStreak), currentStreak(other.currentStreak),
-      averageReactionTime(other.averageReactionTime), reactionTimes(other.reactionTimes),
-      lastInputTime(other.lastInputTime), gameHistory(other.gameHistory) {
+    : hot(other.hot), cold(other.cold ? new PlayerColdState(*other.cold) : nullptr) {
+}
+
+Player::Player(Player&& other) noexcept
+    : hot(other.hot), cold(std::move(other.cold)) {
 }
 
 Player& Player::operator=(const Player& other) {
     if (this != &other) {
-        name = other.name;
-        maxLives = other.maxLives;
-        currentLives = other.currentLives;
-        score = other.score;
-        level = other.level;
-        currentInputSequence = other.currentInputSequence;
-        totalCorrectSequences = other.totalCorrectSequences;
-        totalWrongAttempts = other.totalWrongAttempts;
-        gameStartTime = other.gameStartTime;
-        gameEndTime = other.gameEndTime;
-        bestStreak = other.bestStreak;
-        currentStreak = other.currentStreak;
-        averageReactionTime = other.averageReactionTime;
-        reactionTimes = other.reactionTimes;
-        lastInputTime = other.lastInputTime;
-        gameHistory = other.gameHistory;
+        hot = other.hot;
+        if (!other.cold) {
+            cold.reset();
+        } else if (cold) {
+            *cold = *other.cold; // Reaproveita os buffers já alocados
+        } else {
+            cold.reset(new PlayerColdState(*other.cold));
+        }
     }
     return *this;
 }
 
+Player& Player::operator=(Player&& other) noexcept {
+    if (this != &other) {
+        hot = other.hot;
+        cold = std::move(other.cold);
+    }
+    return *this;
+}
+
+const PlayerHotState& Player::getHotState() const {
+    return hot;
+}
+
 std::string Player::getName() const {
-    return name;
+    return cold->name;
 }
 
 bool Player::setName(const std::string& newName) {
     std::string validatedName = validateAndSetName(newName);
     if (validatedName != "Anonymous" || newName == "Anonymous") {
-        name = validatedName;
+        cold->name = validatedName;
         return true;
     }
     return false;
 }
 
 int Player::getScore() const {
-    return score;
+    return hot.score;
 }
 
 void Player::addScore(int points, const std::string& reason) {
@@ -110,75 +168,66 @@ void Player::addScore(int points, const std::string& reason) {
         return;
     }
     
-    score += points;
+    applyScore(points, cold->gameHistory.intern(reason));
+}
+
+void Player::applyScore(int points, uint32_t reasonId, int32_t reasonParam) {
+    hot.score += points;
     
     // Registrar evento de pontuação
-    std::map<std::string, std::string> event;
-    event["action"] = "score_added";
-    event["points"] = std::to_string(points);
-    event["reason"] = reason;
-    event["totalScore"] = std::to_string(score);
-    gameHistory.push_back(event);
+    cold->gameHistory.record(PlayerAction::SCORE_ADDED, reasonId, points, hot.score, reasonParam);
 }
 
 int Player::getLevel() const {
-    return level;
+    return hot.level;
 }
 
 void Player::advanceLevel(int bonusPoints) {
-    level++;
+    hot.level++;
     
     if (bonusPoints > 0) {
-        addScore(bonusPoints, "Level " + std::to_string(level - 1) + " completion bonus");
+        applyScore(bonusPoints, PlayerHistory::REASON_LEVEL_BONUS, hot.level - 1);
     }
     
     // Atualizar melhor sequência se a atual for melhor
-    if (currentStreak > bestStreak) {
-        bestStreak = currentStreak;
+    if (hot.currentStreak > hot.bestStreak) {
+        hot.bestStreak = hot.currentStreak;
     }
     
-    std::map<std::string, std::string> event;
-    event["action"] = "level_advanced";
-    event["level"] = std::to_string(level);
-    event["bonusPoints"] = std::to_string(bonusPoints);
-    gameHistory.push_back(event);
+    cold->gameHistory.record(PlayerAction::LEVEL_ADVANCED, PlayerHistory::NO_TEXT, hot.level, bonusPoints);
 }
 
 int Player::getLives() const {
-    return currentLives;
+    return hot.currentLives;
 }
 
 int Player::getMaxLives() const {
-    return maxLives;
+    return hot.maxLives;
 }
 
 bool Player::loseLife(const std::string& reason) {
-    if (currentLives > 0) {
-        currentLives--;
-        totalWrongAttempts++;
-        currentStreak = 0; // Resetar sequência em erro
+    if (hot.currentLives > 0) {
+        hot.currentLives--;
+        hot.totalWrongAttempts++;
+        hot.currentStreak = 0; // Resetar sequência em erro
         
-        std::map<std::string, std::string> event;
-        event["action"] = "life_lost";
-        event["reason"] = reason;
-        event["livesRemaining"] = std::to_string(currentLives);
-        gameHistory.push_back(event);
+        cold->gameHistory.record(PlayerAction::LIFE_LOST, cold->gameHistory.intern(reason), hot.currentLives);
     }
     
     return isAlive();
 }
 
 bool Player::isAlive() const {
-    return currentLives > 0;
+    return hot.currentLives > 0;
 }
 
 void Player::resetLives() {
-    currentLives = maxLives;
+    hot.currentLives = hot.maxLives;
 }
 
 void Player::startInputSequence() {
-    currentInputSequence.clear();
-    lastInputTime = std::chrono::steady_clock::now();
+    cold->currentInputSequence.clear();
+    hot.lastInputTime = std::chrono::steady_clock::now();
 }
 
 bool Player::addInput(const std::string& input) {
@@ -189,103 +238,89 @@ bool Player::addInput(const std::string& input) {
     auto currentTime = std::chrono::steady_clock::now();
     
     // Calcular tempo de reação se não for a primeira entrada
-    if (!currentInputSequence.empty()) {
-        auto reactionTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-            currentTime - lastInputTime).count();
-        reactionTimes.push_back(static_cast<double>(reactionTime));
+    if (!cold->currentInputSequence.empty()) {
+        std::chrono::duration<double, std::milli> reactionTime = currentTime - hot.lastInputTime;
+        cold->reactionStats.record(reactionTime.count());
     }
     
-    currentInputSequence.push_back(input);
-    lastInputTime = currentTime;
+    cold->currentInputSequence.push_back(input);
+    hot.lastInputTime = currentTime;
     
-    std::map<std::string, std::string> event;
-    event["action"] = "input_added";
-    event["input"] = input;
-    event["sequencePosition"] = std::to_string(currentInputSequence.size() - 1);
-    gameHistory.push_back(event);
+    cold->gameHistory.record(PlayerAction::INPUT_ADDED, cold->gameHistory.intern(input),
+                             static_cast<int32_t>(cold->currentInputSequence.size() - 1));
     
     return true;
 }
 
 std::vector<std::string> Player::getCurrentInput() const {
-    return currentInputSequence;
+    return cold->currentInputSequence;
 }
 
 void Player::clearCurrentInput() {
-    currentInputSequence.clear();
-    lastInputTime = std::chrono::steady_clock::now();
+    cold->currentInputSequence.clear();
+    hot.lastInputTime = std::chrono::steady_clock::now();
 }
 
 void Player::recordSuccessfulSequence(int sequenceLength) {
-    totalCorrectSequences++;
-    currentStreak++;
+    hot.totalCorrectSequences++;
+    hot.currentStreak++;
     
     // Calcular pontuação base com bônus
     int baseScore = sequenceLength * 10;
-    int streakBonus = (currentStreak / 3) * 5; // Bônus a cada 3 sequências corretas
-    int levelBonus = (level - 1) * 2; // Bônus crescente por nível
+    int streakBonus = (hot.currentStreak / 3) * 5; // Bônus a cada 3 sequências corretas
+    int levelBonus = (hot.level - 1) * 2; // Bônus crescente por nível
     
     int totalPoints = baseScore + streakBonus + levelBonus;
-    addScore(totalPoints, "Sequence completed (Length: " + std::to_string(sequenceLength) + ")");
+    if (totalPoints >= 0) {
+        applyScore(totalPoints, PlayerHistory::REASON_SEQUENCE_COMPLETED, sequenceLength);
+    }
     
-    std::map<std::string, std::string> event;
-    event["action"] = "sequence_completed";
-    event["sequenceLength"] = std::to_string(sequenceLength);
-    event["streak"] = std::to_string(currentStreak);
-    event["pointsEarned"] = std::to_string(totalPoints);
-    gameHistory.push_back(event);
+    cold->gameHistory.record(PlayerAction::SEQUENCE_COMPLETED, PlayerHistory::NO_TEXT,
+                             sequenceLength, hot.currentStreak, totalPoints);
 }
 
 void Player::startGame() {
-    gameStartTime = std::chrono::steady_clock::now();
-    gameEndTime = std::chrono::steady_clock::time_point{};
+    hot.gameStartTime = std::chrono::steady_clock::now();
+    hot.gameEndTime = std::chrono::steady_clock::time_point{};
     
     // Resetar estatísticas específicas do jogo
-    score = 0;
-    level = 1;
-    currentStreak = 0;
-    totalCorrectSequences = 0;
-    totalWrongAttempts = 0;
-    reactionTimes.clear();
-    gameHistory.clear();
+    hot.score = 0;
+    hot.level = 1;
+    hot.currentStreak = 0;
+    hot.totalCorrectSequences = 0;
+    hot.totalWrongAttempts = 0;
+    cold->reactionStats.clear();
+    cold->gameHistory.clear();
     resetLives();
     
-    std::map<std::string, std::string> event;
-    event["action"] = "game_started";
-    event["playerName"] = name;
-    gameHistory.push_back(event);
+    cold->gameHistory.record(PlayerAction::GAME_STARTED, cold->gameHistory.intern(cold->name));
 }
 
 void Player::endGame() {
-    gameEndTime = std::chrono::steady_clock::now();
+    hot.gameEndTime = std::chrono::steady_clock::now();
     
     // Calcular tempo médio de reação
-    if (!reactionTimes.empty()) {
-        double sum = 0.0;
-        for (double time : reactionTimes) {
-            sum += time;
-        }
-        averageReactionTime = sum / reactionTimes.size();
+    if (cold->reactionStats.getCount() > 0) {
+        cold->averageReactionTime = cold->reactionStats.getMean();
     }
     
-    std::map<std::string, std::string> event;
-    event["action"] = "game_ended";
-    event["finalScore"] = std::to_string(score);
-    event["finalLevel"] = std::to_string(level);
-    event["totalTime"] = std::to_string(getGameDuration());
-    gameHistory.push_back(event);
+    // Durações acima de ~24 dias são saturadas no registro de 32 bits
+    long long duration = std::min<long long>(getGameDuration(), INT_MAX);
+    cold->gameHistory.record(PlayerAction::GAME_ENDED, PlayerHistory::NO_TEXT,
+                             hot.score, hot.level, static_cast<int32_t>(duration));
+    cold->gameHistory.flush();
 }
 
 long long Player::getGameDuration() const {
-    if (gameStartTime == std::chrono::steady_clock::time_point{}) {
+    if (hot.gameStartTime == std::chrono::steady_clock::time_point{}) {
         return 0;
     }
     
-    auto endTime = (gameEndTime == std::chrono::steady_clock::time_point{}) ? 
-                   std::chrono::steady_clock::now() : gameEndTime;
+    auto endTime = (hot.gameEndTime == std::chrono::steady_clock::time_point{}) ? 
+                   std::chrono::steady_clock::now() : hot.gameEndTime;
     
     return std::chrono::duration_cast<std::chrono::milliseconds>(
-        endTime - gameStartTime).count();
+        endTime - hot.gameStartTime).count();
 }
 
 std::string Player::getFormattedGameDuration() const {
@@ -301,82 +336,131 @@ std::string Player::getFormattedGameDuration() const {
     return oss.str();
 }
 
+PlayerStats Player::getStats() const {
+    PlayerStats stats;
+    stats.score = hot.score;
+    stats.level = hot.level;
+    stats.lives = hot.currentLives;
+    stats.maxLives = hot.maxLives;
+    stats.totalCorrectSequences = hot.totalCorrectSequences;
+    stats.totalWrongAttempts = hot.totalWrongAttempts;
+    stats.currentStreak = hot.currentStreak;
+    stats.bestStreak = hot.bestStreak;
+    
+    int totalAttempts = getTotalAttempts();
+    stats.accuracy = (totalAttempts > 0) ?
+        (static_cast<double>(hot.totalCorrectSequences) / totalAttempts) * 100.0 : 0.0;
+    
+    stats.averageReactionTime = cold->averageReactionTime;
+    stats.reactionTimeP50 = cold->reactionStats.getPercentile(50.0);
+    stats.reactionTimeP90 = cold->reactionStats.getPercentile(90.0);
+    stats.reactionTimeP99 = cold->reactionStats.getPercentile(99.0);
+    stats.maxReactionTime = cold->reactionStats.getMax();
+    stats.gameDuration = getGameDuration();
+    stats.isGameActive = hot.gameStartTime != std::chrono::steady_clock::time_point{} &&
+                         hot.gameEndTime == std::chrono::steady_clock::time_point{};
+    stats.isAlive = isAlive();
+    return stats;
+}
+
+std::string Player::formatAccuracy(double accuracy) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1) << accuracy;
+    return oss.str();
+}
+
 std::map<std::string, std::string> Player::getStatistics() const {
+    PlayerStats typed = getStats();
     std::map<std::string, std::string> stats;
     
-    stats["name"] = name;
-    stats["score"] = std::to_string(score);
-    stats["level"] = std::to_string(level);
-    stats["lives"] = std::to_string(currentLives);
-    stats["maxLives"] = std::to_string(maxLives);
-    stats["totalCorrectSequences"] = std::to_string(totalCorrectSequences);
-    stats["totalWrongAttempts"] = std::to_string(totalWrongAttempts);
-    stats["currentStreak"] = std::to_string(currentStreak);
-    stats["bestStreak"] = std::to_string(bestStreak);
-    stats["averageReactionTime"] = std::to_string(static_cast<int>(averageReactionTime));
-    stats["gameDuration"] = std::to_string(getGameDuration());
+    stats["name"] = cold->name;
+    stats["score"] = std::to_string(typed.score);
+    stats["level"] = std::to_string(typed.level);
+    stats["lives"] = std::to_string(typed.lives);
+    stats["maxLives"] = std::to_string(typed.maxLives);
+    stats["totalCorrectSequences"] = std::to_string(typed.totalCorrectSequences);
+    stats["totalWrongAttempts"] = std::to_string(typed.totalWrongAttempts);
+    stats["currentStreak"] = std::to_string(typed.currentStreak);
+    stats["bestStreak"] = std::to_string(typed.bestStreak);
+    stats["averageReactionTime"] = std::to_string(static_cast<int>(typed.averageReactionTime));
+    stats["reactionTimeP50"] = std::to_string(static_cast<int>(typed.reactionTimeP50));
+    stats["reactionTimeP90"] = std::to_string(static_cast<int>(typed.reactionTimeP90));
+    stats["reactionTimeP99"] = std::to_string(static_cast<int>(typed.reactionTimeP99));
+    stats["maxReactionTime"] = std::to_string(static_cast<int>(typed.maxReactionTime));
+    stats["gameDuration"] = std::to_string(typed.gameDuration);
     stats["formattedDuration"] = getFormattedGameDuration();
-    
-    int totalAttempts = getTotalAttempts();
-    if (totalAttempts > 0) {
-        double accuracy = (static_cast<double>(totalCorrectSequences) / totalAttempts) * 100.0;
-        std::ostringstream oss;
-        oss << std::fixed << std::setprecision(1) << accuracy;
-        stats["accuracy"] = oss.str();
-    } else {
-        stats["accuracy"] = "0.0";
-    }
-    
-    stats["isGameActive"] = (gameStartTime != std::chrono::steady_clock::time_point{} && 
-                            gameEndTime == std::chrono::steady_clock::time_point{}) ? "true" : "false";
-    stats["isAlive"] = isAlive() ? "true" : "false";
+    stats["accuracy"] = formatAccuracy(typed.accuracy);
+    stats["isGameActive"] = typed.isGameActive ? "true" : "false";
+    stats["isAlive"] = typed.isAlive ? "true" : "false";
     
     return stats;
 }
 
 int Player::getTotalAttempts() const {
-    return totalCorrectSequences + totalWrongAttempts;
+    return hot.totalCorrectSequences + hot.totalWrongAttempts;
 }
 
 std::vector<std::map<std::string, std::string>> Player::getGameHistory() const {
-    return gameHistory;
+    return cold->gameHistory.toMaps();
+}
+
+const ReactionTimeStats& Player::getReactionStats() const {
+    return cold->reactionStats;
+}
+
+const PlayerHistory& Player::getHistory() const {
+    return cold->gameHistory;
+}
+
+void Player::setHistoryCapacity(size_t capacity) {
+    cold->gameHistory.setCapacity(capacity);
+}
+
+bool Player::enableHistorySpill(const std::string& path) {
+    return cold->gameHistory.enableSpill(path);
+}
+
+void Player::disableHistorySpill() {
+    cold->gameHistory.disableSpill();
 }
 
 void Player::reset() {
-    score = 0;
-    level = 1;
-    currentLives = maxLives;
-    currentInputSequence.clear();
-    totalCorrectSequences = 0;
-    totalWrongAttempts = 0;
-    bestStreak = 0;
-    currentStreak = 0;
-    averageReactionTime = 0.0;
-    reactionTimes.clear();
-    gameStartTime = std::chrono::steady_clock::time_point{};
-    gameEndTime = std::chrono::steady_clock::time_point{};
-    lastInputTime = std::chrono::steady_clock::now();
-    gameHistory.clear();
+    hot.score = 0;
+    hot.level = 1;
+    hot.currentLives = hot.maxLives;
+    cold->currentInputSequence.clear();
+    hot.totalCorrectSequences = 0;
+    hot.totalWrongAttempts = 0;
+    hot.bestStreak = 0;
+    hot.currentStreak = 0;
+    cold->averageReactionTime = 0.0;
+    cold->reactionStats.clear();
+    hot.gameStartTime = std::chrono::steady_clock::time_point{};
+    hot.gameEndTime = std::chrono::steady_clock::time_point{};
+    hot.lastInputTime = std::chrono::steady_clock::now();
+    cold->gameHistory.clear();
 }
 
 std::map<std::string, std::string> Player::toSaveData() const {
+    PlayerProfile profile = toProfile();
     std::map<std::string, std::string> saveData;
     
-    saveData["name"] = name;
-    saveData["score"] = std::to_string(score);
-    saveData["level"] = std::to_string(level);
-    saveData["bestStreak"] = std::to_string(bestStreak);
-    saveData["totalCorrectSequences"] = std::to_string(totalCorrectSequences);
-    saveData["averageReactionTime"] = std::to_string(averageReactionTime);
-    saveData["gameDuration"] = std::to_string(getGameDuration());
-    
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    saveData["gameEndTime"] = std::to_string(time_t);
-    
-    int totalAttempts = getTotalAttempts();
+    saveData["name"] = profile.name;
+    saveData["score"] = std::to_string(profile.score);
+    saveData["level"] = std::to_string(profile.level);
+    saveData["lives"] = std::to_string(profile.currentLives);
+    saveData["maxLives"] = std::to_string(profile.maxLives);
+    saveData["bestStreak"] = std::to_string(profile.bestStreak);
+    saveData["currentStreak"] = std::to_string(profile.currentStreak);
+    saveData["totalCorrectSequences"] = std::to_string(profile.totalCorrectSequences);
+    saveData["totalWrongAttempts"] = std::to_string(profile.totalWrongAttempts);
+    saveData["averageReactionTime"] = std::to_string(profile.averageReactionTime);
+    saveData["gameDuration"] = std::to_string(profile.gameDuration);
+    saveData["gameEndTime"] = std::to_string(profile.savedAt);
+    
+    int totalAttempts = profile.totalCorrectSequences + profile.totalWrongAttempts;
     if (totalAttempts > 0) {
-        double accuracy = (static_cast<double>(totalCorrectSequences) / totalAttempts) * 100.0;
+        double accuracy = (static_cast<double>(profile.totalCorrectSequences) / totalAttempts) * 100.0;
         saveData["accuracy"] = std::to_string(accuracy);
     } else {
         saveData["accuracy"] = "0.0";
@@ -387,36 +471,169 @@ std::map<std::string, std::string> Player::toSaveData() const {
 
 bool Player::fromSaveData(const std::map<std::string, std::string>& saveData) {
     try {
+        PlayerProfile profile = toProfile();
+        
         auto it = saveData.find("name");
         if (it != saveData.end()) {
-            setName(it->second);
+            std::string validatedName = validateAndSetName(it->second);
+            std::memset(profile.name, 0, sizeof(profile.name));
+            validatedName.copy(profile.name, sizeof(profile.name) - 1);
+        }
+        
+        const struct {
+            const char* key;
+            int32_t* field;
+        } intFields[] = {
+            {"score", &profile.score},
+            {"level", &profile.level},
+            {"lives", &profile.currentLives},
+            {"maxLives", &profile.maxLives},
+            {"bestStreak", &profile.bestStreak},
+            {"currentStreak", &profile.currentStreak},
+            {"totalCorrectSequences", &profile.totalCorrectSequences},
+            {"totalWrongAttempts", &profile.totalWrongAttempts}
+        };
+        for (const auto& entry : intFields) {
+            it = saveData.find(entry.key);
+            if (it != saveData.end()) {
+                *entry.field = std::stoi(it->second);
+            }
         }
         
-        it = saveData.find("bestStreak");
+        it = saveData.find("averageReactionTime");
         if (it != saveData.end()) {
-            bestStreak = std::stoi(it->second);
+            profile.averageReactionTime = std::stod(it->second);
+        }
+        it = saveData.find("gameDuration");
+        if (it != saveData.end()) {
+            profile.gameDuration = std::stoll(it->second);
         }
         
+        if (!hasValidFields(profile)) {
+            return false;
+        }
+        applyProfileFields(profile);
+        if (saveData.count("gameDuration") > 0) {
+            applyGameDuration(profile.gameDuration);
+        }
         return true;
     } catch (const std::exception&) {
         return false;
     }
 }
 
+PlayerProfile Player::toProfile() const {
+    // Zerar tudo: o checksum é calculado sobre os bytes crus, e o nome só
+    // ocupa parte do seu campo
+    PlayerProfile profile;
+    std::memset(static_cast<void*>(&profile), 0, sizeof(profile));
+    profile.magic = PlayerProfile::MAGIC;
+    profile.version = PlayerProfile::VERSION;
+    profile.size = static_cast<uint16_t>(sizeof(PlayerProfile));
+    cold->name.copy(profile.name, sizeof(profile.name) - 1);
+    profile.score = hot.score;
+    profile.level = hot.level;
+    profile.currentLives = hot.currentLives;
+    profile.maxLives = hot.maxLives;
+    profile.totalCorrectSequences = hot.totalCorrectSequences;
+    profile.totalWrongAttempts = hot.totalWrongAttempts;
+    profile.bestStreak = hot.bestStreak;
+    profile.currentStreak = hot.currentStreak;
+    profile.gameDuration = getGameDuration();
+    profile.savedAt = static_cast<int64_t>(
+        std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()));
+    profile.averageReactionTime = cold->averageReactionTime;
+    profile.reactionStats = cold->reactionStats;
+    profile.reserved = 0;
+    profile.checksum = profileChecksum(profile);
+    return profile;
+}
+
+bool Player::isValidProfile(const PlayerProfile& profile) {
+    return profile.magic == PlayerProfile::MAGIC &&
+           profile.version == PlayerProfile::VERSION &&
+           profile.size == sizeof(PlayerProfile) &&
+           profile.checksum == profileChecksum(profile);
+}
+
+bool Player::hasValidFields(const PlayerProfile& profile) {
+    return std::memchr(profile.name, '\0', sizeof(profile.name)) != nullptr &&
+           profile.maxLives >= 1 && profile.currentLives >= 0 && profile.currentLives <= profile.maxLives &&
+           profile.level >= 1 && profile.score >= 0 && profile.gameDuration >= 0 &&
+           profile.totalCorrectSequences >= 0 && profile.totalWrongAttempts >= 0 &&
+           profile.bestStreak >= 0 && profile.currentStreak >= 0;
+}
+
+void Player::applyProfileFields(const PlayerProfile& profile) {
+    cold->name = validateAndSetName(profile.name);
+    hot.score = profile.score;
+    hot.level = profile.level;
+    hot.currentLives = profile.currentLives;
+    hot.maxLives = profile.maxLives;
+    hot.totalCorrectSequences = profile.totalCorrectSequences;
+    hot.totalWrongAttempts = profile.totalWrongAttempts;
+    hot.bestStreak = profile.bestStreak;
+    hot.currentStreak = profile.currentStreak;
+    cold->averageReactionTime = profile.averageReactionTime;
+    cold->reactionStats = profile.reactionStats;
+}
+
+void Player::applyGameDuration(int64_t gameDuration) {
+    // Os instantes do relógio monotônico não sobrevivem entre execuções:
+    // o jogo salvo é reconstruído como terminado agora, com a mesma duração
+    if (gameDuration > 0) {
+        hot.gameEndTime = std::chrono::steady_clock::now();
+        hot.gameStartTime = hot.gameEndTime - std::chrono::milliseconds(gameDuration);
+    } else {
+        hot.gameStartTime = std::chrono::steady_clock::time_point{};
+        hot.gameEndTime = std::chrono::steady_clock::time_point{};
+    }
+}
+
+bool Player::fromProfile(const PlayerProfile& profile) {
+    if (!isValidProfile(profile) || !hasValidFields(profile)) {
+        return false;
+    }
+    
+    applyProfileFields(profile);
+    cold->currentInputSequence.clear();
+    applyGameDuration(profile.gameDuration);
+    return true;
+}
+
+bool Player::saveProfile(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    PlayerProfile profile = toProfile();
+    file.write(reinterpret_cast<const char*>(&profile), sizeof(profile));
+    return file.good();
+}
+
+bool Player::loadProfile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    PlayerProfile profile;
+    if (!file.read(reinterpret_cast<char*>(&profile), sizeof(profile))) {
+        return false;
+    }
+    return fromProfile(profile);
+}
+
 int Player::compareWith(const Player& other) const {
     // Comparação primária: pontuação
-    if (score != other.score) {
-        return other.score - score; // Pontuação maior fica primeiro
+    if (hot.score != other.hot.score) {
+        return other.hot.score - hot.score; // Pontuação maior fica primeiro
     }
     
     // Comparação secundária: nível
-    if (level != other.level) {
-        return other.level - level; // Nível maior fica primeiro
+    if (hot.level != other.hot.level) {
+        return other.hot.level - hot.level; // Nível maior fica primeiro
     }
     
     // Comparação terciária: melhor sequência
-    if (bestStreak != other.bestStreak) {
-        return other.bestStreak - bestStreak; // Sequência maior fica primeiro
+    if (hot.bestStreak != other.hot.bestStreak) {
+        return other.hot.bestStreak - hot.bestStreak; // Sequência maior fica primeiro
     }
     
     // Comparação final: precisão
@@ -424,9 +641,9 @@ int Player::compareWith(const Player& other) const {
     int otherAttempts = other.getTotalAttempts();
     
     double thisAccuracy = (thisAttempts > 0) ? 
-        (static_cast<double>(totalCorrectSequences) / thisAttempts) : 0.0;
+        (static_cast<double>(hot.totalCorrectSequences) / thisAttempts) : 0.0;
     double otherAccuracy = (otherAttempts > 0) ? 
-        (static_cast<double>(other.totalCorrectSequences) / otherAttempts) : 0.0;
+        (static_cast<double>(other.hot.totalCorrectSequences) / otherAttempts) : 0.0;
     
     if (thisAccuracy != otherAccuracy) {
         return (otherAccuracy > thisAccuracy) ? 1 : -1;
@@ -436,7 +653,7 @@ int Player::compareWith(const Player& other) const {
 }
 
 bool Player::operator==(const Player& other) const {
-    return name == other.name && score == other.score && level == other.level;
+    return cold->name == other.cold->name && hot.score == other.hot.score && hot.level == other.hot.level;
 }
 
 bool Player::operator!=(const Player& other) const {
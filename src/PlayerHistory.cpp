@@ -0,0 +1,355 @@
+/**
+ * @file PlayerHistory.cpp
+ * @brief Implementação da classe PlayerHistory
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "PlayerHistory.h"
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+
+const uint32_t PlayerHistory::NO_TEXT;
+const uint32_t PlayerHistory::REASON_SEQUENCE_COMPLETED;
+const uint32_t PlayerHistory::REASON_LEVEL_BONUS;
+const uint32_t PlayerHistory::SPILL_MAGIC;
+const uint16_t PlayerHistory::SPILL_VERSION;
+
+static_assert(sizeof(PlayerEvent) == 32, "PlayerEvent deve ter layout fixo");
+
+namespace {
+
+/**
+ * @struct SpillHeader
+ * @brief Cabeçalho do arquivo de spill
+ */
+struct SpillHeader {
+    uint32_t magic;       ///< SPILL_MAGIC
+    uint16_t version;     ///< SPILL_VERSION
+    uint16_t recordSize;  ///< sizeof(PlayerEvent)
+};
+
+/// Ação reservada para registros que definem um texto internado
+/// (textId = identificador, values[0] = bytes do texto, seguidos pelos bytes)
+const uint8_t SPILL_TEXT_RECORD = 0xFF;
+
+} // namespace
+
+PlayerHistory::PlayerHistory() : head(0), capacity(0), totalRecorded(0) {
+}
+
+PlayerHistory::PlayerHistory(const PlayerHistory& other)
+    : events(other.events), head(other.head), capacity(other.capacity),
+      totalRecorded(other.totalRecorded), texts(other.texts), textIds(other.textIds) {
+}
+
+PlayerHistory::PlayerHistory(PlayerHistory&& other)
+    : events(std::move(other.events)), head(other.head), capacity(other.capacity),
+      totalRecorded(other.totalRecorded), texts(std::move(other.texts)),
+      textIds(std::move(other.textIds)), spill(std::move(other.spill)) {
+    other.events.clear();
+    other.head = 0;
+    other.totalRecorded = 0;
+}
+
+PlayerHistory& PlayerHistory::operator=(const PlayerHistory& other) {
+    if (this != &other) {
+        events = other.events;
+        head = other.head;
+        capacity = other.capacity;
+        totalRecorded = other.totalRecorded;
+        texts = other.texts;
+        textIds = other.textIds;
+
+        // O arquivo deste objeto continua ativo; os textos atuais precisam estar definidos nele
+        if (isSpilling()) {
+            for (uint32_t id = 0; id < texts.size(); ++id) {
+                spillText(id);
+            }
+        }
+    }
+    return *this;
+}
+
+PlayerHistory& PlayerHistory::operator=(PlayerHistory&& other) {
+    if (this != &other) {
+        events = std::move(other.events);
+        head = other.head;
+        capacity = other.capacity;
+        totalRecorded = other.totalRecorded;
+        texts = std::move(other.texts);
+        textIds = std::move(other.textIds);
+        spill = std::move(other.spill);
+        other.events.clear();
+        other.head = 0;
+        other.totalRecorded = 0;
+    }
+    return *this;
+}
+
+uint32_t PlayerHistory::intern(const std::string& text) {
+    auto it = textIds.find(text);
+    if (it != textIds.end()) {
+        return it->second;
+    }
+
+    uint32_t id = static_cast<uint32_t>(texts.size());
+    texts.push_back(text);
+    textIds.insert(std::make_pair(text, id));
+    if (spill) {
+        spillText(id);
+    }
+    return id;
+}
+
+void PlayerHistory::record(PlayerAction action, uint32_t textId,
+                           int32_t value0, int32_t value1, int32_t value2) {
+    PlayerEvent event;
+    std::memset(&event, 0, sizeof(event)); // Bytes de preenchimento determinísticos no spill
+    event.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    event.textId = textId;
+    event.action = action;
+    event.values[0] = value0;
+    event.values[1] = value1;
+    event.values[2] = value2;
+    append(event);
+}
+
+void PlayerHistory::append(const PlayerEvent& event) {
+    if (capacity == 0 || events.size() < capacity) {
+        events.push_back(event);
+    } else {
+        // Anel cheio: sobrescrever o evento mais antigo
+        events[head] = event;
+        head = (head + 1 == capacity) ? 0 : head + 1;
+    }
+    totalRecorded++;
+
+    if (spill) {
+        spillEvent(event);
+    }
+}
+
+void PlayerHistory::clear() {
+    events.clear();
+    head = 0;
+    totalRecorded = 0;
+}
+
+void PlayerHistory::linearize() {
+    if (head != 0) {
+        std::rotate(events.begin(), events.begin() + head, events.end());
+        head = 0;
+    }
+}
+
+void PlayerHistory::setCapacity(size_t newCapacity) {
+    linearize();
+    if (newCapacity != 0 && events.size() > newCapacity) {
+        events.erase(events.begin(), events.end() - newCapacity);
+    }
+    capacity = newCapacity;
+    if (capacity != 0) {
+        events.reserve(capacity);
+    }
+}
+
+size_t PlayerHistory::getCapacity() const {
+    return capacity;
+}
+
+size_t PlayerHistory::size() const {
+    return events.size();
+}
+
+bool PlayerHistory::empty() const {
+    return events.empty();
+}
+
+uint64_t PlayerHistory::getTotalRecorded() const {
+    return totalRecorded;
+}
+
+const PlayerEvent& PlayerHistory::at(size_t index) const {
+    size_t position = head + index;
+    return events[position < events.size() ? position : position - events.size()];
+}
+
+std::vector<PlayerEvent> PlayerHistory::getEvents() const {
+    std::vector<PlayerEvent> result;
+    result.reserve(events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+        result.push_back(at(i));
+    }
+    return result;
+}
+
+bool PlayerHistory::enableSpill(const std::string& path) {
+    std::unique_ptr<std::ofstream> file(new std::ofstream(path, std::ios::binary | std::ios::app));
+    if (!file->is_open()) {
+        return false;
+    }
+
+    // Arquivo novo recebe o cabeçalho; arquivos existentes continuam recebendo registros
+    file->seekp(0, std::ios::end);
+    if (file->tellp() == std::streampos(0)) {
+        SpillHeader header = {SPILL_MAGIC, SPILL_VERSION, static_cast<uint16_t>(sizeof(PlayerEvent))};
+        file->write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    spill = std::move(file);
+    for (uint32_t id = 0; id < texts.size(); ++id) {
+        spillText(id);
+    }
+    for (size_t i = 0; i < events.size(); ++i) {
+        spillEvent(at(i));
+    }
+    return isSpilling();
+}
+
+void PlayerHistory::disableSpill() {
+    spill.reset();
+}
+
+bool PlayerHistory::isSpilling() const {
+    return spill && spill->good();
+}
+
+void PlayerHistory::flush() {
+    if (spill) {
+        spill->flush();
+    }
+}
+
+void PlayerHistory::spillEvent(const PlayerEvent& event) {
+    spill->write(reinterpret_cast<const char*>(&event), sizeof(event));
+}
+
+void PlayerHistory::spillText(uint32_t id) {
+    PlayerEvent definition;
+    std::memset(&definition, 0, sizeof(definition));
+    definition.textId = id;
+    definition.action = static_cast<PlayerAction>(SPILL_TEXT_RECORD);
+    definition.values[0] = static_cast<int32_t>(texts[id].size());
+    spill->write(reinterpret_cast<const char*>(&definition), sizeof(definition));
+    spill->write(texts[id].data(), static_cast<std::streamsize>(texts[id].size()));
+}
+
+bool PlayerHistory::loadSpillFile(const std::string& path, PlayerHistory& history) {
+    std::ifstream file(path, std::ios::binary);
+    SpillHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != SPILL_MAGIC || header.version != SPILL_VERSION ||
+        header.recordSize != sizeof(PlayerEvent)) {
+        return false;
+    }
+
+    // Identificadores do arquivo para identificadores do histórico de destino.
+    // Vários históricos podem ter acrescentado registros ao mesmo arquivo, por
+    // isso uma definição posterior substitui a anterior.
+    std::vector<uint32_t> idMap;
+    PlayerEvent event;
+    while (file.read(reinterpret_cast<char*>(&event), sizeof(event))) {
+        if (static_cast<uint8_t>(event.action) == SPILL_TEXT_RECORD) {
+            if (event.values[0] < 0) {
+                break;
+            }
+            std::string text(static_cast<size_t>(event.values[0]), '\0');
+            if (!text.empty() && !file.read(&text[0], static_cast<std::streamsize>(text.size()))) {
+                break;
+            }
+            if (event.textId >= idMap.size()) {
+                idMap.resize(event.textId + 1, NO_TEXT);
+            }
+            idMap[event.textId] = history.intern(text);
+            continue;
+        }
+
+        uint32_t textId = event.textId;
+        if (textId < REASON_LEVEL_BONUS) {
+            textId = textId < idMap.size() ? idMap[textId] : NO_TEXT;
+        }
+        event.textId = textId;
+        history.append(event);
+    }
+
+    return true;
+}
+
+std::string PlayerHistory::textOf(const PlayerEvent& event) const {
+    switch (event.textId) {
+        case NO_TEXT:
+            return std::string();
+        case REASON_SEQUENCE_COMPLETED:
+            return "Sequence completed (Length: " + std::to_string(event.values[2]) + ")";
+        case REASON_LEVEL_BONUS:
+            return "Level " + std::to_string(event.values[2]) + " completion bonus";
+        default:
+            return event.textId < texts.size() ? texts[event.textId] : std::string();
+    }
+}
+
+const char* PlayerHistory::actionName(PlayerAction action) {
+    switch (action) {
+        case PlayerAction::GAME_STARTED:       return "game_started";
+        case PlayerAction::INPUT_ADDED:        return "input_added";
+        case PlayerAction::SCORE_ADDED:        return "score_added";
+        case PlayerAction::LEVEL_ADVANCED:     return "level_advanced";
+        case PlayerAction::LIFE_LOST:          return "life_lost";
+        case PlayerAction::SEQUENCE_COMPLETED: return "sequence_completed";
+        case PlayerAction::GAME_ENDED:         return "game_ended";
+    }
+    return "";
+}
+
+std::map<std::string, std::string> PlayerHistory::toMap(const PlayerEvent& event) const {
+    std::map<std::string, std::string> result;
+    result["action"] = actionName(event.action);
+
+    switch (event.action) {
+        case PlayerAction::GAME_STARTED:
+            result["playerName"] = textOf(event);
+            break;
+        case PlayerAction::INPUT_ADDED:
+            result["input"] = textOf(event);
+            result["sequencePosition"] = std::to_string(event.values[0]);
+            break;
+        case PlayerAction::SCORE_ADDED:
+            result["points"] = std::to_string(event.values[0]);
+            result["reason"] = textOf(event);
+            result["totalScore"] = std::to_string(event.values[1]);
+            break;
+        case PlayerAction::LEVEL_ADVANCED:
+            result["level"] = std::to_string(event.values[0]);
+            result["bonusPoints"] = std::to_string(event.values[1]);
+            break;
+        case PlayerAction::LIFE_LOST:
+            result["reason"] = textOf(event);
+            result["livesRemaining"] = std::to_string(event.values[0]);
+            break;
+        case PlayerAction::SEQUENCE_COMPLETED:
+            result["sequenceLength"] = std::to_string(event.values[0]);
+            result["streak"] = std::to_string(event.values[1]);
+            result["pointsEarned"] = std::to_string(event.values[2]);
+            break;
+        case PlayerAction::GAME_ENDED:
+            result["finalScore"] = std::to_string(event.values[0]);
+            result["finalLevel"] = std::to_string(event.values[1]);
+            result["totalTime"] = std::to_string(event.values[2]);
+            break;
+    }
+
+    return result;
+}
+
+std::vector<std::map<std::string, std::string>> PlayerHistory::toMaps() const {
+    std::vector<std::map<std::string, std::string>> result;
+    result.reserve(events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+        result.push_back(toMap(at(i)));
+    }
+    return result;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file ReactionTimeStats.cpp
+ * @brief Implementação da classe ReactionTimeStats
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "ReactionTimeStats.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+const unsigned ReactionTimeStats::SUB_BUCKET_BITS;
+const unsigned ReactionTimeStats::MAX_VALUE_BITS;
+const size_t ReactionTimeStats::BUCKET_COUNT;
+
+namespace {
+
+const uint64_t SUB_BUCKET_COUNT = 1ULL << ReactionTimeStats::SUB_BUCKET_BITS;  ///< 32
+const uint64_t MAX_MICROS = (1ULL << ReactionTimeStats::MAX_VALUE_BITS) - 1;
+
+/**
+ * @brief Calcula floor(log2(value)) de um valor não nulo
+ */
+inline unsigned floorLog2(uint64_t value) {
+#if defined(__GNUC__)
+    return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    unsigned result = 0;
+    while (value >>= 1) {
+        result++;
+    }
+    return result;
+#endif
+}
+
+} // namespace
+
+ReactionTimeStats::ReactionTimeStats() {
+    clear();
+}
+
+size_t ReactionTimeStats::bucketIndex(uint64_t micros) {
+    if (micros < 2 * SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(micros);
+    }
+    // Valores em [32 * 2^s, 64 * 2^s) ocupam os 32 baldes de largura 2^s
+    unsigned shift = floorLog2(micros) - SUB_BUCKET_BITS;
+    return static_cast<size_t>(((shift + 1) << SUB_BUCKET_BITS) + (micros >> shift) - SUB_BUCKET_COUNT);
+}
+
+double ReactionTimeStats::bucketMidpoint(size_t index) {
+    if (index < 2 * SUB_BUCKET_COUNT) {
+        return static_cast<double>(index);
+    }
+    unsigned shift = static_cast<unsigned>(index >> SUB_BUCKET_BITS) - 1;
+    uint64_t lower = ((index & (SUB_BUCKET_COUNT - 1)) + SUB_BUCKET_COUNT) << shift;
+    return static_cast<double>(lower) + static_cast<double>((1ULL << shift) - 1) / 2.0;
+}
+
+void ReactionTimeStats::record(double milliseconds) {
+    double value = milliseconds > 0.0 ? milliseconds : 0.0;
+
+    // Welford
+    count++;
+    double delta = value - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (value - mean);
+
+    if (count == 1 || value < minValue) {
+        minValue = value;
+    }
+    if (count == 1 || value > maxValue) {
+        maxValue = value;
+    }
+
+    double micros = std::floor(value * 1000.0);
+    uint64_t clamped = micros >= static_cast<double>(MAX_MICROS) ? MAX_MICROS : static_cast<uint64_t>(micros);
+    buckets[bucketIndex(clamped)]++;
+}
+
+void ReactionTimeStats::merge(const ReactionTimeStats& other) {
+    if (other.count == 0) {
+        return;
+    }
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+
+    // Combinação de variâncias de Chan et al.
+    double total = static_cast<double>(count + other.count);
+    double delta = other.mean - mean;
+    m2 += other.m2 + delta * delta * static_cast<double>(count) * static_cast<double>(other.count) / total;
+    mean += delta * static_cast<double>(other.count) / total;
+    count += other.count;
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        buckets[i] += other.buckets[i];
+    }
+}
+
+void ReactionTimeStats::clear() {
+    count = 0;
+    mean = 0.0;
+    m2 = 0.0;
+    minValue = 0.0;
+    maxValue = 0.0;
+    std::memset(buckets, 0, sizeof(buckets));
+}
+
+uint64_t ReactionTimeStats::getCount() const {
+    return count;
+}
+
+double ReactionTimeStats::getMean() const {
+    return mean;
+}
+
+double ReactionTimeStats::getVariance() const {
+    return count > 1 ? m2 / static_cast<double>(count - 1) : 0.0;
+}
+
+double ReactionTimeStats::getStdDev() const {
+    return std::sqrt(getVariance());
+}
+
+double ReactionTimeStats::getMin() const {
+    return minValue;
+}
+
+double ReactionTimeStats::getMax() const {
+    return maxValue;
+}
+
+double ReactionTimeStats::getPercentile(double percentile) const {
+    if (count == 0) {
+        return 0.0;
+    }
+
+    double fraction = std::min(std::max(percentile, 0.0), 100.0) / 100.0;
+    uint64_t rank = static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(count)));
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            double value = bucketMidpoint(i) / 1000.0;
+            return std::min(std::max(value, minValue), maxValue);
+        }
+    }
+    return maxValue;
+}
@@ -0,0 +1,276 @@
+/**
+ * @file ScoreArchive.cpp
+ * @brief Implementação da classe ScoreArchive
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "ScoreArchive.h"
+#include <cstring>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <type_traits>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+const size_t ScoreRecord::NAME_SIZE;
+const uint32_t ScoreArchive::MAGIC;
+const uint16_t ScoreArchive::VERSION;
+const uint16_t ScoreArchive::MIN_VERSION;
+
+static_assert(sizeof(ScoreRecord) == 64, "Mudanças no layout de ScoreRecord exigem nova VERSION");
+static_assert(sizeof(ScoreArchiveHeader) == 32, "Mudanças no layout do cabeçalho exigem nova VERSION");
+static_assert(std::is_trivially_copyable<ScoreRecord>::value, "ScoreRecord deve ser copiável byte a byte");
+
+namespace {
+
+const uint32_t FNV32_OFFSET = 2166136261u;
+const uint32_t FNV32_PRIME = 16777619u;
+
+/**
+ * @brief Acumula bytes em um hash FNV-1a de 32 bits
+ */
+uint32_t fnv32(uint32_t hash, const unsigned char* bytes, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * FNV32_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief Calcula o checksum de um cabeçalho e do conteúdo que o segue
+ */
+uint32_t archiveChecksum(ScoreArchiveHeader header, const unsigned char* records, size_t size,
+                         const unsigned char* texts = nullptr, size_t textSize = 0) {
+    header.checksum = 0;
+    uint32_t hash = fnv32(FNV32_OFFSET, reinterpret_cast<const unsigned char*>(&header), sizeof(header));
+    return fnv32(fnv32(hash, records, size), texts, textSize);
+}
+
+} // namespace
+
+ScoreArchive::ScoreArchive() : data(nullptr), length(0), mapped(false) {
+}
+
+ScoreArchive::~ScoreArchive() {
+    close();
+}
+
+const ScoreArchiveHeader& ScoreArchive::header() const {
+    return *reinterpret_cast<const ScoreArchiveHeader*>(data);
+}
+
+const char* ScoreArchive::texts() const {
+    return reinterpret_cast<const char*>(data + sizeof(ScoreArchiveHeader) +
+                                         static_cast<size_t>(header().count) * sizeof(ScoreRecord));
+}
+
+bool ScoreArchive::open(const std::string& path, bool verifyChecksum) {
+    close();
+
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(ScoreArchiveHeader))) {
+        ::close(fd);
+        return false;
+    }
+    void* address = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // O mapeamento continua válido sem o descritor
+    if (address == MAP_FAILED) {
+        return false;
+    }
+    data = static_cast<const unsigned char*>(address);
+    length = static_cast<size_t>(info.st_size);
+    mapped = true;
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::streamoff fileSize = file.tellg();
+    if (fileSize < static_cast<std::streamoff>(sizeof(ScoreArchiveHeader))) {
+        return false;
+    }
+    buffer.resize(static_cast<size_t>(fileSize));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(buffer.data()), fileSize)) {
+        buffer.clear();
+        return false;
+    }
+    data = buffer.data();
+    length = buffer.size();
+#endif
+
+    // A área de textos deve ocupar exatamente o resto do arquivo e terminar em '\0',
+    // para que toda posição dentro dela seja uma string terminada
+    const ScoreArchiveHeader& head = header();
+    size_t recordsEnd = sizeof(ScoreArchiveHeader) + static_cast<size_t>(head.count) * sizeof(ScoreRecord);
+    bool valid = head.magic == MAGIC && head.version >= MIN_VERSION && head.version <= VERSION &&
+                 head.recordSize == sizeof(ScoreRecord) && length >= recordsEnd &&
+                 head.textSize == length - recordsEnd &&
+                 (head.textSize == 0 || data[length - 1] == '\0');
+    if (valid && verifyChecksum) {
+        valid = head.checksum == archiveChecksum(head, data + sizeof(ScoreArchiveHeader),
+                                                 length - sizeof(ScoreArchiveHeader));
+    }
+    if (!valid) {
+        close();
+    }
+    return valid;
+}
+
+void ScoreArchive::close() {
+#ifndef _WIN32
+    if (mapped) {
+        ::munmap(const_cast<unsigned char*>(data), length);
+    }
+#endif
+    buffer.clear();
+    data = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+bool ScoreArchive::isOpen() const {
+    return data != nullptr;
+}
+
+size_t ScoreArchive::size() const {
+    return isOpen() ? header().count : 0;
+}
+
+uint64_t ScoreArchive::getGeneration() const {
+    return isOpen() ? header().generation : 0;
+}
+
+const ScoreRecord* ScoreArchive::records() const {
+    if (size() == 0) {
+        return nullptr;
+    }
+    // O cabeçalho de 32 bytes mantém os registros alinhados (mmap começa em página)
+    return reinterpret_cast<const ScoreRecord*>(data + sizeof(ScoreArchiveHeader));
+}
+
+const ScoreRecord& ScoreArchive::operator[](size_t index) const {
+    return records()[index];
+}
+
+ScoreEntry ScoreArchive::getEntry(size_t index) const {
+    const ScoreRecord& record = records()[index];
+    ScoreEntry entry;
+    const void* terminator = std::memchr(record.playerName, '\0', ScoreRecord::NAME_SIZE);
+    size_t nameLength = terminator != nullptr
+        ? static_cast<size_t>(static_cast<const char*>(terminator) - record.playerName)
+        : ScoreRecord::NAME_SIZE;
+    entry.playerName.assign(record.playerName, nameLength);
+    entry.score = record.score;
+    entry.level = record.level;
+    entry.timestamp = record.timestamp;
+    entry.duration = record.duration;
+    entry.accuracy = record.accuracy;
+    entry.streak = record.streak;
+
+    // Posições fora da área são ignoradas (open() garante o terminador final)
+    if (record.dateOffset != 0 && record.dateOffset <= header().textSize) {
+        entry.date = texts() + (record.dateOffset - 1);
+    } else {
+        entry.date = getEntryDate(entry);
+    }
+    return entry;
+}
+
+bool ScoreArchive::write(const std::string& path, const std::vector<ScoreRecord>& records,
+                         const std::string& texts, uint64_t generation) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    ScoreArchiveHeader head;
+    std::memset(&head, 0, sizeof(head));
+    head.magic = MAGIC;
+    head.version = VERSION;
+    head.recordSize = static_cast<uint16_t>(sizeof(ScoreRecord));
+    head.count = static_cast<uint32_t>(records.size());
+    head.generation = generation;
+    head.textSize = texts.size();
+    size_t recordBytes = records.size() * sizeof(ScoreRecord);
+    head.checksum = archiveChecksum(head, reinterpret_cast<const unsigned char*>(records.data()), recordBytes,
+                                    reinterpret_cast<const unsigned char*>(texts.data()), texts.size());
+
+    file.write(reinterpret_cast<const char*>(&head), sizeof(head));
+    file.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(recordBytes));
+    file.write(texts.data(), static_cast<std::streamsize>(texts.size()));
+    file.close();
+    return !file.fail();
+}
+
+bool ScoreArchive::isArchiveFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    uint32_t magic = 0;
+    return file.read(reinterpret_cast<char*>(&magic), sizeof(magic)) && magic == MAGIC;
+}
+
+std::string ScoreArchive::formatTimestamp(int64_t timestamp) {
+    std::time_t time = static_cast<std::time_t>(timestamp);
+    std::tm* timeinfo = std::localtime(&time);
+    if (timeinfo == nullptr) {
+        return std::string();
+    }
+
+    char text[64];
+    std::snprintf(text, sizeof(text), "%02d/%02d/%d %02d:%02d", timeinfo->tm_mday,
+                  timeinfo->tm_mon + 1, timeinfo->tm_year + 1900, timeinfo->tm_hour, timeinfo->tm_min);
+    return text;
+}
+
+int64_t ScoreArchive::parseDate(const std::string& date) {
+    std::tm timeinfo;
+    std::memset(&timeinfo, 0, sizeof(timeinfo));
+    if (std::sscanf(date.c_str(), "%d/%d/%d %d:%d", &timeinfo.tm_mday, &timeinfo.tm_mon,
+                    &timeinfo.tm_year, &timeinfo.tm_hour, &timeinfo.tm_min) != 5) {
+        return 0;
+    }
+    timeinfo.tm_mon -= 1;
+    timeinfo.tm_year -= 1900;
+    timeinfo.tm_isdst = -1;
+    std::time_t time = std::mktime(&timeinfo);
+    return time == static_cast<std::time_t>(-1) ? 0 : static_cast<int64_t>(time);
+}
+
+std::string ScoreArchive::getEntryDate(const ScoreEntry& entry) {
+    if (!entry.date.empty() || entry.timestamp == 0) {
+        return entry.date;
+    }
+    return formatTimestamp(entry.timestamp);
+}
+
+ScoreRecord ScoreArchive::toRecord(const ScoreEntry& entry, std::string& texts) {
+    ScoreRecord record;
+    std::memset(&record, 0, sizeof(record));
+    entry.playerName.copy(record.playerName, ScoreRecord::NAME_SIZE - 1);
+    record.score = entry.score;
+    record.level = entry.level;
+    record.timestamp = entry.timestamp;
+    record.duration = entry.duration;
+    record.accuracy = entry.accuracy;
+    record.streak = entry.streak;
+
+    // Só a data que o timestamp não reproduz ocupa a área de textos
+    if (!entry.date.empty() && (entry.timestamp == 0 || entry.date != formatTimestamp(entry.timestamp))) {
+        record.dateOffset = static_cast<uint32_t>(texts.size() + 1);
+        texts.append(entry.date.c_str(), entry.date.size() + 1);
+    }
+    return record;
+}
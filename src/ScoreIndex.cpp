@@ -0,0 +1,215 @@
+/**
+ * @file ScoreIndex.cpp
+ * @brief Implementação da classe ScoreIndex
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "ScoreIndex.h"
+
+const int32_t ScoreIndex::NIL;
+
+ScoreIndex::ScoreIndex() : root(NIL), seed(2463534242u) {
+}
+
+uint32_t ScoreIndex::totalOf(int32_t node) const {
+    return node == NIL ? 0 : nodes[node].total;
+}
+
+void ScoreIndex::update(int32_t node) {
+    nodes[node].total = nodes[node].count + totalOf(nodes[node].left) + totalOf(nodes[node].right);
+}
+
+int32_t ScoreIndex::rotateRight(int32_t node) {
+    int32_t child = nodes[node].left;
+    nodes[node].left = nodes[child].right;
+    nodes[child].right = node;
+    update(node);
+    update(child);
+    return child;
+}
+
+int32_t ScoreIndex::rotateLeft(int32_t node) {
+    int32_t child = nodes[node].right;
+    nodes[node].right = nodes[child].left;
+    nodes[child].left = node;
+    update(node);
+    update(child);
+    return child;
+}
+
+int32_t ScoreIndex::allocateNode(int score) {
+    // xorshift32: prioridades só precisam ser bem espalhadas, não imprevisíveis
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    Node node = {score, 1, 1, seed, NIL, NIL};
+    if (!freeNodes.empty()) {
+        int32_t index = freeNodes.back();
+        freeNodes.pop_back();
+        nodes[index] = node;
+        return index;
+    }
+    nodes.push_back(node);
+    return static_cast<int32_t>(nodes.size() - 1);
+}
+
+int32_t ScoreIndex::insertAt(int32_t node, int score) {
+    if (node == NIL) {
+        return allocateNode(score);
+    }
+
+    if (score == nodes[node].score) {
+        nodes[node].count++;
+        nodes[node].total++;
+        return node;
+    }
+
+    // O filho é obtido antes de indexar nodes: allocateNode pode realocar o vetor
+    if (score < nodes[node].score) {
+        int32_t child = insertAt(nodes[node].left, score);
+        nodes[node].left = child;
+        nodes[node].total++;
+        if (nodes[child].priority > nodes[node].priority) {
+            return rotateRight(node);
+        }
+    } else {
+        int32_t child = insertAt(nodes[node].right, score);
+        nodes[node].right = child;
+        nodes[node].total++;
+        if (nodes[child].priority > nodes[node].priority) {
+            return rotateLeft(node);
+        }
+    }
+    return node;
+}
+
+int32_t ScoreIndex::eraseAt(int32_t node, int score, bool& erased) {
+    if (node == NIL) {
+        return NIL;
+    }
+
+    if (score < nodes[node].score) {
+        int32_t child = eraseAt(nodes[node].left, score, erased);
+        nodes[node].left = child;
+    } else if (score > nodes[node].score) {
+        int32_t child = eraseAt(nodes[node].right, score, erased);
+        nodes[node].right = child;
+    } else if (nodes[node].count > 1) {
+        nodes[node].count--;
+        erased = true;
+    } else if (nodes[node].left == NIL || nodes[node].right == NIL) {
+        int32_t child = nodes[node].left == NIL ? nodes[node].right : nodes[node].left;
+        freeNodes.push_back(node);
+        erased = true;
+        return child;
+    } else {
+        // Desce o nó girando o filho de maior prioridade para cima
+        if (nodes[nodes[node].left].priority > nodes[nodes[node].right].priority) {
+            node = rotateRight(node);
+            int32_t child = eraseAt(nodes[node].right, score, erased);
+            nodes[node].right = child;
+        } else {
+            node = rotateLeft(node);
+            int32_t child = eraseAt(nodes[node].left, score, erased);
+            nodes[node].left = child;
+        }
+    }
+
+    update(node);
+    return node;
+}
+
+void ScoreIndex::insert(int score) {
+    root = insertAt(root, score);
+}
+
+bool ScoreIndex::erase(int score) {
+    bool erased = false;
+    root = eraseAt(root, score, erased);
+    return erased;
+}
+
+void ScoreIndex::clear() {
+    nodes.clear();
+    freeNodes.clear();
+    root = NIL;
+}
+
+size_t ScoreIndex::size() const {
+    return totalOf(root);
+}
+
+size_t ScoreIndex::countAbove(int score) const {
+    size_t result = 0;
+    int32_t node = root;
+    while (node != NIL) {
+        const Node& current = nodes[node];
+        if (score < current.score) {
+            result += current.count + totalOf(current.right);
+            node = current.left;
+        } else if (score > current.score) {
+            node = current.right;
+        } else {
+            result += totalOf(current.right);
+            break;
+        }
+    }
+    return result;
+}
+
+size_t ScoreIndex::countBelow(int score) const {
+    size_t result = 0;
+    int32_t node = root;
+    while (node != NIL) {
+        const Node& current = nodes[node];
+        if (score > current.score) {
+            result += current.count + totalOf(current.left);
+            node = current.right;
+        } else if (score < current.score) {
+            node = current.left;
+        } else {
+            result += totalOf(current.left);
+            break;
+        }
+    }
+    return result;
+}
+
+size_t ScoreIndex::countInRange(int low, int high) const {
+    if (low > high) {
+        return 0;
+    }
+    return size() - countBelow(low) - countAbove(high);
+}
+
+size_t ScoreIndex::rank(int score) const {
+    return countAbove(score) + 1;
+}
+
+int ScoreIndex::select(size_t k) const {
+    int32_t node = root;
+    while (node != NIL) {
+        const Node& current = nodes[node];
+        size_t above = totalOf(current.right);
+        if (k <= above) {
+            node = current.right;
+        } else if (k <= above + current.count) {
+            return current.score;
+        } else {
+            k -= above + current.count;
+            node = current.left;
+        }
+    }
+    return 0; // k fora de [1, size()]
+}
+
+double ScoreIndex::percentile(int score) const {
+    size_t total = size();
+    if (total == 0) {
+        return 0.0;
+    }
+    return 100.0 * static_cast<double>(countBelow(score)) / static_cast<double>(total);
+}
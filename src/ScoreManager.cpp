@@ -7,16 +7,126 @@
  */
 
 #include "ScoreManager.h"
+#include "ScoreArchive.h"
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
 #include <iostream>
-#include <set>
 #include <cmath>
+#include <cstdio>
 
-ScoreManager::ScoreManager(size_t maxScores, const std::string& filename)
-    : maxScores(std::max(static_cast<size_t>(1), maxScores)), filename(filename) {
+const size_t ScoreManager::DEFAULT_COMPACTION_THRESHOLD;
+
+namespace {
+
+const char* const GENERATION_PREFIX = "# Generation: ";
+
+/**
+ * @brief Divide uma linha nos campos separados por '|'
+ */
+std::vector<std::string> splitFields(const std::string& line) {
+    std::istringstream iss(line);
+    std::string token;
+    std::vector<std::string> tokens;
+    while (std::getline(iss, token, '|')) {
+        tokens.push_back(token);
+    }
+    return tokens;
+}
+
+/**
+ * @brief Converte os campos nome|pontuacao|nivel|data|precisao|duracao|sequencia|timestamp
+ * @param tokens Campos da linha
+ * @param first Índice do campo com o nome
+ * @param entry Entrada preenchida
+ * @return true se os campos obrigatórios eram válidos
+ */
+bool parseEntryFields(const std::vector<std::string>& tokens, size_t first, ScoreEntry& entry) {
+    if (tokens.size() < first + 4) {
+        return false;
+    }
+    try {
+        entry.playerName = tokens[first];
+        entry.score = std::stoi(tokens[first + 1]);
+        entry.level = std::stoi(tokens[first + 2]);
+        entry.date = tokens[first + 3];
+        entry.accuracy = (tokens.size() > first + 4) ? std::stod(tokens[first + 4]) : 0.0;
+        entry.duration = (tokens.size() > first + 5) ? std::stoll(tokens[first + 5]) : 0;
+        entry.streak = (tokens.size() > first + 6) ? std::stoi(tokens[first + 6]) : 0;
+        entry.timestamp = (tokens.size() > first + 7) ? std::stoll(tokens[first + 7]) : 0;
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+/**
+ * @brief Grava uma entrada no formato nome|pontuacao|nivel|data|precisao|duracao|sequencia|timestamp
+ */
+void writeEntry(std::ostream& out, const ScoreEntry& entry) {
+    out << entry.playerName << "|"
+        << entry.score << "|"
+        << entry.level << "|"
+        << ScoreArchive::getEntryDate(entry) << "|"
+        << std::fixed << std::setprecision(1) << entry.accuracy << "|"
+        << entry.duration << "|"
+        << entry.streak << "|"
+        << entry.timestamp;
+}
+
+/**
+ * @brief Verifica se uma entrada é a que foi gravada em um registro
+ *
+ * A precisão é gravada com uma casa decimal e por isso é comparada nesse
+ * formato. As datas são comparadas pelo valor efetivo, pois o registro
+ * grava a data formatada de uma entrada que só tenha o timestamp.
+ */
+bool matchesRecordedEntry(const ScoreEntry& entry, const ScoreEntry& recorded) {
+    if (entry.playerName != recorded.playerName || entry.score != recorded.score ||
+        entry.level != recorded.level || entry.timestamp != recorded.timestamp ||
+        entry.duration != recorded.duration || entry.streak != recorded.streak ||
+        ScoreArchive::getEntryDate(entry) != ScoreArchive::getEntryDate(recorded)) {
+        return false;
+    }
+    std::ostringstream a, b;
+    a << std::fixed << std::setprecision(1) << entry.accuracy;
+    b << std::fixed << std::setprecision(1) << recorded.accuracy;
+    return a.str() == b.str();
+}
+
+/**
+ * @brief Lê a geração de uma linha de comentário "# Generation: N"
+ * @return true se a linha era uma linha de geração
+ */
+bool parseGeneration(const std::string& line, uint64_t& value) {
+    std::string prefix(GENERATION_PREFIX);
+    if (line.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    try {
+        value = std::stoull(line.substr(prefix.size()));
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+/**
+ * @brief Formata um percentil com uma casa decimal
+ */
+std::string formatPercentile(double percentile) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1) << percentile;
+    return oss.str();
+}
+
+} // namespace
+
+ScoreManager::ScoreManager(size_t maxScores, const std::string& filename, ScoreFileFormat format)
+    : scores(maxScores), filename(filename),
+      fileFormat(format), logMode(false), compactionThreshold(DEFAULT_COMPACTION_THRESHOLD), logRecords(0),
+      generation(0) {
     
     fileAvailable = checkFileAvailability();
     loadScores();
@@ -24,7 +134,14 @@ ScoreManager::ScoreManager(size_t maxScores, const std::string& filename)
 }
 
 ScoreManager::~ScoreManager() {
-    saveScores();
+    if (logMode) {
+        // Todas as alterações já estão no log
+        if (logStream) {
+            logStream->flush();
+        }
+    } else {
+        saveScores();
+    }
 }
 
 bool ScoreManager::checkFileAvailability() {
@@ -37,13 +154,14 @@ bool ScoreManager::checkFileAvailability() {
 }
 
 void ScoreManager::validateScoreFormat() {
-    auto it = std::remove_if(scores.begin(), scores.end(), [](const ScoreEntry& entry) {
+    std::vector<ScoreEntry> entries = scores.toVector();
+    auto it = std::remove_if(entries.begin(), entries.end(), [](const ScoreEntry& entry) {
         return entry.playerName.empty() || entry.score < 0;
     });
-    scores.erase(it, scores.end());
+    entries.erase(it, entries.end());
     
     // Limitar nome dos jogadores
-    for (auto& entry : scores) {
+    for (auto& entry : entries) {
         if (entry.playerName.length() > 20) {
             entry.playerName = entry.playerName.substr(0, 20);
         }
@@ -52,50 +170,62 @@ void ScoreManager::validateScoreFormat() {
         entry.accuracy = std::max(0.0, std::min(100.0, entry.accuracy));
     }
     
-    sortScores();
-    if (scores.size() > maxScores) {
-        scores.resize(maxScores);
-    }
+    scores.assign(std::move(entries));
 }
 
 bool ScoreManager::loadScores() {
+    scores.clear();
+    generation = 0;
+    logRecords = 0;
+    
     if (!fileAvailable) {
-        scores.clear();
         return false;
     }
     
+    std::vector<ScoreEntry> entries;
+    bool loaded = ScoreArchive::isArchiveFile(filename) ? loadBinaryScores(entries) : loadTextScores(entries);
+    if (!loaded) {
+        return false;
+    }
+    
+    scores.assign(std::move(entries));
+    replayLog();
+    return true;
+}
+
+bool ScoreManager::loadBinaryScores(std::vector<ScoreEntry>& entries) {
+    ScoreArchive archive;
+    if (!archive.open(filename)) {
+        return false;
+    }
+    
+    generation = archive.getGeneration();
+    entries.reserve(archive.size());
+    for (size_t i = 0; i < archive.size(); ++i) {
+        entries.push_back(archive.getEntry(i));
+    }
+    return true;
+}
+
+bool ScoreManager::loadTextScores(std::vector<ScoreEntry>& entries) {
     std::ifstream file(filename);
     if (!file.is_open()) {
-        scores.clear();
         return false;
     }
     
-    scores.clear();
     std::string line;
     
-    // Formato: nome|pontuacao|nivel|data|precisao|duracao|sequencia
+    // Formato: nome|pontuacao|nivel|data|precisao|duracao|sequencia|timestamp
     while (std::getline(file, line)) {
-        if (line.empty() || line[0] == '#') continue; // Ignorar comentários
-        
-        std::istringstream iss(line);
-        std::string token;
-        std::vector<std::string> tokens;
-        
-        while (std::getline(iss, token, '|')) {
-            tokens.push_back(token);
+        if (line.empty()) continue;
+        if (line[0] == '#') { // Comentários (a geração do snapshot vem em um deles)
+            parseGeneration(line, generation);
+            continue;
         }
         
-        if (tokens.size() >= 4) {
-            ScoreEntry entry;
-            entry.playerName = tokens[0];
-            entry.score = std::stoi(tokens[1]);
-            entry.level = (tokens.size() > 2) ? std::stoi(tokens[2]) : 1;
-            entry.date = tokens[3];
-            entry.accuracy = (tokens.size() > 4) ? std::stod(tokens[4]) : 0.0;
-            entry.duration = (tokens.size() > 5) ? std::stoll(tokens[5]) : 0;
-            entry.streak = (tokens.size() > 6) ? std::stoi(tokens[6]) : 0;
-            
-            scores.push_back(entry);
+        ScoreEntry entry;
+        if (parseEntryFields(splitFields(line), 0, entry)) {
+            entries.push_back(entry);
         }
     }
     
@@ -103,37 +233,185 @@ bool ScoreManager::loadScores() {
     return true;
 }
 
-bool ScoreManager::saveScores() {
-    if (!fileAvailable) {
-        return false;
+bool ScoreManager::writeSnapshot(const std::string& path, uint64_t snapshotGeneration) const {
+    if (fileFormat == ScoreFileFormat::BINARY) {
+        std::vector<ScoreRecord> records;
+        std::string texts;
+        records.reserve(scores.size());
+        for (const auto& entry : scores) {
+            records.push_back(ScoreArchive::toRecord(entry, texts));
+        }
+        return ScoreArchive::write(path, records, texts, snapshotGeneration);
     }
     
-    std::ofstream file(filename);
+    std::ofstream file(path);
     if (!file.is_open()) {
         return false;
     }
     
     file << "# Simon Game High Scores\n";
-    file << "# Format: nome|pontuacao|nivel|data|precisao|duracao|sequencia\n";
+    file << GENERATION_PREFIX << snapshotGeneration << "\n";
+    file << "# Format: nome|pontuacao|nivel|data|precisao|duracao|sequencia|timestamp\n";
     
     for (const auto& entry : scores) {
-        file << entry.playerName << "|"
-             << entry.score << "|"
-             << entry.level << "|"
-             << entry.date << "|"
-             << std::fixed << std::setprecision(1) << entry.accuracy << "|"
-             << entry.duration << "|"
-             << entry.streak << "\n";
+        writeEntry(file, entry);
+        file << "\n";
     }
     
     file.close();
+    return !file.fail();
+}
+
+bool ScoreManager::saveScores() {
+    if (!fileAvailable) {
+        return false;
+    }
+    
+    // Arquivo temporário + rename: o snapshot anterior continua íntegro até o fim da gravação
+    std::string tempName = filename + ".tmp";
+    if (!writeSnapshot(tempName, generation + 1)) {
+        std::remove(tempName.c_str());
+        return false;
+    }
+    if (std::rename(tempName.c_str(), filename.c_str()) != 0) {
+        // Plataformas em que rename não substitui um arquivo existente
+        std::remove(filename.c_str());
+        if (std::rename(tempName.c_str(), filename.c_str()) != 0) {
+            std::remove(tempName.c_str());
+            return false;
+        }
+    }
+    
+    generation++;
+    return resetLog();
+}
+
+bool ScoreManager::resetLog() {
+    logRecords = 0;
+    logStream.reset();
+    
+    if (!logMode) {
+        std::remove(getLogFilename().c_str());
+        return true;
+    }
+    
+    logStream.reset(new std::ofstream(getLogFilename(), std::ios::trunc));
+    if (!logStream->is_open()) {
+        logStream.reset();
+        return false;
+    }
+    *logStream << "# Simon Game Score Log\n";
+    *logStream << GENERATION_PREFIX << generation << "\n";
+    *logStream << "# Registros: A|entrada, D|entrada, P|nome, C\n";
+    logStream->flush();
+    return logStream->good();
+}
+
+bool ScoreManager::appendLog(const std::string& record) {
+    if (!logStream) {
+        logStream.reset(new std::ofstream(getLogFilename(), std::ios::app));
+        if (!logStream->is_open()) {
+            logStream.reset();
+            return false;
+        }
+    }
+    
+    *logStream << record << '\n';
+    logStream->flush();
+    if (!logStream->good()) {
+        return false;
+    }
+    
+    logRecords++;
+    if (logRecords >= compactionThreshold) {
+        return saveScores();
+    }
     return true;
 }
 
-void ScoreManager::sortScores() {
-    std::sort(scores.begin(), scores.end(), [](const ScoreEntry& a, const ScoreEntry& b) {
-        return a > b; // Usa o operador > definido em ScoreEntry
-    });
+bool ScoreManager::persist(const std::string& record) {
+    if (logMode && fileAvailable) {
+        return appendLog(record);
+    }
+    return saveScores();
+}
+
+void ScoreManager::replayLog() {
+    std::ifstream log(getLogFilename());
+    if (!log.is_open()) {
+        return;
+    }
+    
+    bool sameGeneration = false;
+    std::string line;
+    while (std::getline(log, line)) {
+        if (log.eof()) {
+            break; // Último registro sem '\n': gravação interrompida
+        }
+        if (line.empty()) continue;
+        
+        uint64_t logGeneration = 0;
+        if (line[0] == '#') {
+            if (parseGeneration(line, logGeneration)) {
+                sameGeneration = (logGeneration == generation);
+            }
+            continue;
+        }
+        
+        if (!sameGeneration) {
+            break; // Log anterior ao snapshot: já foi incorporado
+        }
+        if (applyLogRecord(line)) {
+            logRecords++;
+        }
+    }
+}
+
+bool ScoreManager::applyLogRecord(const std::string& record) {
+    std::vector<std::string> tokens = splitFields(record);
+    if (tokens.empty()) {
+        return false;
+    }
+    
+    const std::string& operation = tokens[0];
+    if (operation == "A") {
+        ScoreEntry entry;
+        if (!parseEntryFields(tokens, 1, entry)) {
+            return false;
+        }
+        insertEntry(entry);
+        return true;
+    }
+    if (operation == "D") {
+        // O registro traz a entrada completa: entradas do mesmo jogador com a
+        // mesma pontuação e data ainda se distinguem pelos demais campos
+        ScoreEntry removed;
+        if (!parseEntryFields(tokens, 1, removed)) {
+            return false;
+        }
+        size_t index = 0;
+        for (const auto& entry : scores) {
+            if (matchesRecordedEntry(entry, removed)) {
+                scores.erase(index);
+                break;
+            }
+            index++;
+        }
+        return true;
+    }
+    if (operation == "P" && tokens.size() >= 2) {
+        erasePlayerScores(tokens[1]);
+        return true;
+    }
+    if (operation == "C") {
+        scores.clear();
+        return true;
+    }
+    return false;
+}
+
+size_t ScoreManager::insertEntry(const ScoreEntry& entry) {
+    return scores.insert(entry);
 }
 
 std::string ScoreManager::formatDate(const std::string& dateString) const {
@@ -202,16 +480,23 @@ std::string ScoreManager::getCurrentTimestamp() const {
 }
 
 ScoreManager::ScoreManager(const ScoreManager& other)
-    : scores(other.scores), maxScores(other.maxScores), filename(other.filename),
-      fileAvailable(other.fileAvailable) {
+    : scores(other.scores), filename(other.filename),
+      fileAvailable(other.fileAvailable), fileFormat(other.fileFormat), logMode(other.logMode),
+      compactionThreshold(other.compactionThreshold), logRecords(other.logRecords),
+      generation(other.generation) {
 }
 
 ScoreManager& ScoreManager::operator=(const ScoreManager& other) {
     if (this != &other) {
         scores = other.scores;
-        maxScores = other.maxScores;
         filename = other.filename;
         fileAvailable = other.fileAvailable;
+        fileFormat = other.fileFormat;
+        logMode = other.logMode;
+        compactionThreshold = other.compactionThreshold;
+        logRecords = other.logRecords;
+        generation = other.generation;
+        logStream.reset(); // Reaberto sob demanda (o arquivo pode ter mudado)
     }
     return *this;
 }
@@ -229,14 +514,29 @@ std::map<std::string, std::string> ScoreManager::addScore(const std::string& pla
         return result;
     }
     
+    // Com o ranking cheio, uma pontuação menor que a última nunca entra
+    // (empates são decididos por nível, sequência e precisão, então só
+    // pontuações iguais à última precisam da comparação completa)
+    if (scores.full() && score < scores.back().score) {
+        result["success"] = "true";
+        result["error"] = "";
+        result["rank"] = "0";
+        result["isNewRecord"] = "false";
+        result["saved"] = "true";
+        result["totalScores"] = std::to_string(scores.size());
+        result["percentile"] = formatPercentile(getPercentile(score));
+        return result;
+    }
+    
     // Verificar se é um novo recorde
-    bool isNewRecord = scores.empty() || score > scores[0].score;
+    bool isNewRecord = scores.empty() || score > scores.front().score;
     
     // Criar nova entrada
     ScoreEntry newEntry;
     newEntry.playerName = playerName.substr(0, 20);
     newEntry.score = score;
-    newEntry.date = getCurrentTimestamp();
+    newEntry.timestamp = static_cast<long long>(std::time(nullptr));
+    newEntry.date = ScoreArchive::formatTimestamp(newEntry.timestamp);
     
     // Dados adicionais opcionais
     auto it = additionalData.find("level");
@@ -251,77 +551,49 @@ std::map<std::string, std::string> ScoreManager::addScore(const std::string& pla
     it = additionalData.find("streak");
     newEntry.streak = (it != additionalData.end()) ? std::stoi(it->second) : 0;
     
-    // Adicionar à lista
-    scores.push_back(newEntry);
-    
-    // Ordenar e limitar
-    sortScores();
-    if (scores.size() > maxScores) {
-        scores.resize(maxScores);
+    // Inserção ordenada; a posição de inserção é a colocação. Uma pontuação
+    // que não entra no ranking não altera nada e não precisa ser persistida.
+    bool saved = true;
+    size_t rank = insertEntry(newEntry);
+    if (rank > 0) {
+        std::ostringstream record;
+        record << "A|";
+        writeEntry(record, newEntry);
+        saved = persist(record.str());
     }
     
-    // Encontrar posição da nova pontuação
-    int rank = 0;
-    for (size_t i = 0; i < scores.size(); ++i) {
-        if (scores[i].playerName == newEntry.playerName &&
-            scores[i].score == newEntry.score &&
-            scores[i].date == newEntry.date) {
-            rank = static_cast<int>(i + 1);
-            break;
-        }
-    }
-    
-    bool saved = saveScores();
-    
     result["success"] = "true";
     result["error"] = "";
     result["rank"] = std::to_string(rank);
     result["isNewRecord"] = isNewRecord ? "true" : "false";
     result["saved"] = saved ? "true" : "false";
     result["totalScores"] = std::to_string(scores.size());
+    result["percentile"] = formatPercentile(getPercentile(score));
     
     return result;
 }
 
 std::vector<ScoreEntry> ScoreManager::getScores(int limit) const {
-    if (limit < 0 || static_cast<size_t>(limit) >= scores.size()) {
-        return scores;
+    if (limit < 0) {
+        return scores.toVector();
     }
     
-    return std::vector<ScoreEntry>(scores.begin(), scores.begin() + limit);
+    return scores.toVector(static_cast<size_t>(limit));
 }
 
 const ScoreEntry* ScoreManager::getTopScore() const {
     if (scores.empty()) {
         return nullptr;
     }
-    return &scores[0];
+    return &scores.front();
 }
 
 std::vector<ScoreEntry> ScoreManager::getPlayerScores(const std::string& playerName) const {
-    std::vector<ScoreEntry> playerScores;
-    
-    std::string normalizedName = playerName;
-    std::transform(normalizedName.begin(), normalizedName.end(), normalizedName.begin(), ::tolower);
-    
-    for (const auto& entry : scores) {
-        std::string entryName = entry.playerName;
-        std::transform(entryName.begin(), entryName.end(), entryName.begin(), ::tolower);
-        
-        if (entryName == normalizedName) {
-            playerScores.push_back(entry);
-        }
-    }
-    
-    return playerScores;
+    return scores.getPlayerEntries(playerName);
 }
 
 const ScoreEntry* ScoreManager::getPlayerBestScore(const std::string& playerName) const {
-    auto playerScores = getPlayerScores(playerName);
-    if (playerScores.empty()) {
-        return nullptr;
-    }
-    return &playerScores[0]; // Já está ordenado, primeiro é o melhor
+    return scores.findPlayerBest(playerName);
 }
 
 bool ScoreManager::isQualifyingScore(int score) const {
@@ -330,7 +602,7 @@ bool ScoreManager::isQualifyingScore(int score) const {
     }
     
     // Se temos menos que o máximo, qualquer pontuação válida se qualifica
-    if (scores.size() < maxScores) {
+    if (!scores.full()) {
         return true;
     }
     
@@ -338,6 +610,25 @@ bool ScoreManager::isQualifyingScore(int score) const {
     return score > scores.back().score;
 }
 
+size_t ScoreManager::getRankForScore(int score) const {
+    return scores.getIndex().rank(score);
+}
+
+int ScoreManager::getScoreAtRank(size_t rank) const {
+    if (rank < 1 || rank > scores.size()) {
+        return -1;
+    }
+    return scores.getIndex().select(rank);
+}
+
+size_t ScoreManager::countScoresInRange(int minScore, int maxScore) const {
+    return scores.getIndex().countInRange(minScore, maxScore);
+}
+
+double ScoreManager::getPercentile(int score) const {
+    return scores.getIndex().percentile(score);
+}
+
 std::map<std::string, std::string> ScoreManager::getStatistics() const {
     std::map<std::string, std::string> stats;
     
@@ -356,23 +647,18 @@ std::map<std::string, std::string> ScoreManager::getStatistics() const {
     int totalScore = 0, totalLevel = 0;
     double totalAccuracy = 0.0;
     long long totalDuration = 0;
-    std::set<std::string> uniquePlayers;
     
     for (const auto& entry : scores) {
         totalScore += entry.score;
         totalLevel += entry.level;
         totalAccuracy += entry.accuracy;
         totalDuration += entry.duration;
-        
-        std::string normalizedName = entry.playerName;
-        std::transform(normalizedName.begin(), normalizedName.end(), normalizedName.begin(), ::tolower);
-        uniquePlayers.insert(normalizedName);
     }
     
     size_t count = scores.size();
     stats["totalScores"] = std::to_string(count);
     stats["averageScore"] = std::to_string(totalScore / static_cast<int>(count));
-    stats["highestScore"] = std::to_string(scores[0].score);
+    stats["highestScore"] = std::to_string(scores.front().score);
     stats["lowestScore"] = std::to_string(scores.back().score);
     stats["averageLevel"] = std::to_string(static_cast<int>(std::round(static_cast<double>(totalLevel) / count)));
     
@@ -380,7 +666,7 @@ std::map<std::string, std::string> ScoreManager::getStatistics() const {
     oss << std::fixed << std::setprecision(1) << (totalAccuracy / count);
     stats["averageAccuracy"] = oss.str();
     
-    stats["totalPlayers"] = std::to_string(uniquePlayers.size());
+    stats["totalPlayers"] = std::to_string(scores.getPlayerCount());
     stats["averageDuration"] = formatDuration(totalDuration / static_cast<long long>(count));
     
     return stats;
@@ -388,7 +674,7 @@ std::map<std::string, std::string> ScoreManager::getStatistics() const {
 
 bool ScoreManager::clearScores() {
     scores.clear();
-    return saveScores();
+    return persist("C");
 }
 
 bool ScoreManager::removeScore(size_t index) {
@@ -396,32 +682,26 @@ bool ScoreManager::removeScore(size_t index) {
         return false;
     }
     
-    scores.erase(scores.begin() + index);
-    return saveScores();
+    std::ostringstream record;
+    record << "D|";
+    writeEntry(record, scores[index]);
+    scores.erase(index);
+    return persist(record.str());
 }
 
 int ScoreManager::removePlayerScores(const std::string& playerName) {
-    std::string normalizedName = playerName;
-    std::transform(normalizedName.begin(), normalizedName.end(), normalizedName.begin(), ::tolower);
-    
-    size_t initialSize = scores.size();
-    
-    auto it = std::remove_if(scores.begin(), scores.end(), [&normalizedName](const ScoreEntry& entry) {
-        std::string entryName = entry.playerName;
-        std::transform(entryName.begin(), entryName.end(), entryName.begin(), ::tolower);
-        return entryName == normalizedName;
-    });
-    
-    scores.erase(it, scores.end());
-    
-    int removedCount = static_cast<int>(initialSize - scores.size());
+    int removedCount = erasePlayerScores(playerName);
     if (removedCount > 0) {
-        saveScores();
+        persist("P|" + playerName);
     }
     
     return removedCount;
 }
 
+int ScoreManager::erasePlayerScores(const std::string& playerName) {
+    return static_cast<int>(scores.removePlayer(playerName));
+}
+
 std::string ScoreManager::exportScores() const {
     std::ostringstream oss;
     
@@ -429,16 +709,11 @@ std::string ScoreManager::exportScores() const {
     oss << "# Data de exportação: " << getCurrentTimestamp() << "\n";
     oss << "# Versão: 1.0\n";
     oss << "# Total de pontuações: " << scores.size() << "\n";
-    oss << "# Formato: nome|pontuacao|nivel|data|precisao|duracao|sequencia\n\n";
+    oss << "# Formato: nome|pontuacao|nivel|data|precisao|duracao|sequencia|timestamp\n\n";
     
     for (const auto& entry : scores) {
-        oss << entry.playerName << "|"
-            << entry.score << "|"
-            << entry.level << "|"
-            << entry.date << "|"
-            << std::fixed << std::setprecision(1) << entry.accuracy << "|"
-            << entry.duration << "|"
-            << entry.streak << "\n";
+        writeEntry(oss, entry);
+        oss << "\n";
     }
     
     return oss.str();
@@ -447,8 +722,10 @@ std::string ScoreManager::exportScores() const {
 std::map<std::string, std::string> ScoreManager::importScores(const std::string& data, bool merge) {
     std::map<std::string, std::string> result;
     
-    if (!merge) {
-        scores.clear();
+    // Entradas existentes primeiro: em empates elas continuam à frente
+    std::vector<ScoreEntry> entries;
+    if (merge) {
+        entries = scores.toVector();
     }
     
     std::istringstream iss(data);
@@ -458,41 +735,22 @@ std::map<std::string, std::string> ScoreManager::importScores(const std::string&
     while (std::getline(iss, line)) {
         if (line.empty() || line[0] == '#') continue;
         
-        std::istringstream lineStream(line);
-        std::string token;
-        std::vector<std::string> tokens;
-        
-        while (std::getline(lineStream, token, '|')) {
-            tokens.push_back(token);
+        ScoreEntry entry;
+        if (!parseEntryFields(splitFields(line), 0, entry)) {
+            continue; // Ignorar linhas inválidas
         }
         
-        if (tokens.size() >= 4) {
-            try {
-                ScoreEntry entry;
-                entry.playerName = tokens[0];
-                entry.score = std::stoi(tokens[1]);
-                entry.level = (tokens.size() > 2) ? std::stoi(tokens[2]) : 1;
-                entry.date = tokens[3];
-                entry.accuracy = (tokens.size() > 4) ? std::stod(tokens[4]) : 0.0;
-                entry.duration = (tokens.size() > 5) ? std::stoll(tokens[5]) : 0;
-                entry.streak = (tokens.size() > 6) ? std::stoi(tokens[6]) : 0;
-                
-                if (!entry.playerName.empty() && entry.score >= 0) {
-                    scores.push_back(entry);
-                    importedCount++;
-                }
-            } catch (...) {
-                continue; // Ignorar linhas inválidas
-            }
+        if (!entry.playerName.empty() && entry.score >= 0) {
+            entries.push_back(entry);
+            importedCount++;
         }
     }
     
+    if (!merge || importedCount > 0) {
+        scores.assign(std::move(entries));
+    }
+    
     if (importedCount > 0) {
-        sortScores();
-        if (scores.size() > maxScores) {
-            scores.resize(maxScores);
-        }
-        
         bool saved = saveScores();
         
         result["success"] = "true";
@@ -518,7 +776,7 @@ bool ScoreManager::isStorageWorking() const {
 }
 
 size_t ScoreManager::getMaxScores() const {
-    return maxScores;
+    return scores.getCapacity();
 }
 
 bool ScoreManager::setMaxScores(size_t newMax) {
@@ -526,10 +784,7 @@ bool ScoreManager::setMaxScores(size_t newMax) {
         return false;
     }
     
-    maxScores = newMax;
-    
-    if (scores.size() > maxScores) {
-        scores.resize(maxScores);
+    if (scores.setCapacity(newMax) > 0) {
         saveScores();
     }
     
@@ -546,4 +801,35 @@ bool ScoreManager::reload() {
 
 size_t ScoreManager::getTotalScores() const {
     return scores.size();
+}
+
+ScoreFileFormat ScoreManager::getFileFormat() const {
+    return fileFormat;
+}
+
+bool ScoreManager::setFileFormat(ScoreFileFormat format) {
+    fileFormat = format;
+    return saveScores();
+}
+
+bool ScoreManager::setLogMode(bool enabled, size_t compactionThreshold) {
+    logMode = enabled;
+    this->compactionThreshold = std::max(static_cast<size_t>(1), compactionThreshold);
+    return saveScores();
+}
+
+bool ScoreManager::isLogMode() const {
+    return logMode;
+}
+
+bool ScoreManager::compact() {
+    return saveScores();
+}
+
+size_t ScoreManager::getLogRecordCount() const {
+    return logRecords;
+}
+
+std::string ScoreManager::getLogFilename() const {
+    return filename + ".log";
 }
\ No newline at end of file
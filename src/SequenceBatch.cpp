@@ -0,0 +1,138 @@
+/**
+ * @file SequenceBatch.cpp
+ * @brief Implementação da classe SequenceBatch
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "SequenceBatch.h"
+#include <stdexcept>
+#include <algorithm>
+
+namespace {
+const size_t BATCH_LANES = 64;  ///< Sessões processadas por bloco do Philox
+}
+
+SequenceBatch::SequenceBatch(const std::vector<std::string>& colors, uint64_t seed,
+                             size_t maxSequenceLength)
+    : availableColors(colors), rng(seed), maxSequenceLength(maxSequenceLength) {
+    if (!SequenceGenerator::isValidAlphabet(availableColors)) {
+        throw std::invalid_argument("SequenceBatch: alfabeto inválido");
+    }
+
+    if (maxSequenceLength < 1) {
+        throw std::invalid_argument("SequenceBatch: maxSequenceLength deve ser um número positivo");
+    }
+}
+
+size_t SequenceBatch::addSession(uint64_t sessionId) {
+    return addSessions(sessionId, 1);
+}
+
+size_t SequenceBatch::addSessions(uint64_t firstSessionId, size_t count) {
+    size_t first = sessionIds.size();
+    sessionIds.reserve(first + count);
+    for (size_t i = 0; i < count; ++i) {
+        sessionIds.push_back(firstSessionId + i);
+    }
+    lengths.resize(first + count, 0);
+    symbols.resize((first + count) * maxSequenceLength, 0);
+    return first;
+}
+
+size_t SequenceBatch::extendAll() {
+    const uint32_t range = static_cast<uint32_t>(availableColors.size());
+    const uint32_t threshold = (0u - range) % range;
+    const uint64_t seed = rng.getSeed();
+    const CounterRng::Key key = {{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}};
+
+    uint32_t ctr0[BATCH_LANES], ctr1[BATCH_LANES], ctr2[BATCH_LANES], ctr3[BATCH_LANES];
+    size_t extended = 0;
+
+    for (size_t base = 0; base < sessionIds.size(); base += BATCH_LANES) {
+        size_t lanes = std::min(BATCH_LANES, sessionIds.size() - base);
+
+        // Contador {índice, sessão} de cada linha, como em CounterRng::blockAt
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            ctr0[lane] = lengths[base + lane];
+            ctr1[lane] = 0;
+            ctr2[lane] = static_cast<uint32_t>(sessionIds[base + lane]);
+            ctr3[lane] = static_cast<uint32_t>(sessionIds[base + lane] >> 32);
+        }
+
+        CounterRng::philoxLanes(ctr0, ctr1, ctr2, ctr3, lanes, key);
+
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            size_t slot = base + lane;
+            if (lengths[slot] >= maxSequenceLength) {
+                continue;
+            }
+
+            // Caminho rápido: primeira palavra aceita pela redução de Lemire;
+            // caso contrário, o caminho escalar aplica a mesma reamostragem
+            uint64_t product = static_cast<uint64_t>(ctr0[lane]) * range;
+            uint32_t symbolId = static_cast<uint32_t>(product) >= threshold
+                ? static_cast<uint32_t>(product >> 32)
+                : CounterRng(seed, sessionIds[slot]).boundedAt(lengths[slot], range);
+
+            symbols[slot * maxSequenceLength + lengths[slot]] = static_cast<uint8_t>(symbolId);
+            lengths[slot]++;
+            extended++;
+        }
+    }
+
+    return extended;
+}
+
+void SequenceBatch::clear() {
+    sessionIds.clear();
+    lengths.clear();
+    symbols.clear();
+}
+
+size_t SequenceBatch::size() const {
+    return sessionIds.size();
+}
+
+uint64_t SequenceBatch::getSessionId(size_t slot) const {
+    return sessionIds[slot];
+}
+
+size_t SequenceBatch::getLength(size_t slot) const {
+    return lengths[slot];
+}
+
+uint8_t SequenceBatch::getSymbolId(size_t slot, size_t index) const {
+    return symbols[slot * maxSequenceLength + index];
+}
+
+const uint8_t* SequenceBatch::getSessionSymbols(size_t slot) const {
+    return symbols.data() + slot * maxSequenceLength;
+}
+
+const std::vector<uint32_t>& SequenceBatch::getLengths() const {
+    return lengths;
+}
+
+uint64_t SequenceBatch::getSeed() const {
+    return rng.getSeed();
+}
+
+SequenceGenerator SequenceBatch::toGenerator(size_t slot) const {
+    if (slot >= sessionIds.size()) {
+        throw std::out_of_range("SequenceBatch: posição inválida");
+    }
+
+    SequenceGenerator generator(availableColors, 1, maxSequenceLength);
+    generator.setSeed(rng.getSeed(), sessionIds[slot]);
+
+    std::vector<std::string> sequence;
+    sequence.reserve(lengths[slot]);
+    for (size_t i = 0; i < lengths[slot]; ++i) {
+        sequence.push_back(availableColors[getSymbolId(slot, i)]);
+    }
+
+    generator.setCustomSequence(sequence);
+    return generator;
+}
@@ -12,18 +12,55 @@
 #include <sstream>
 #include <map>
 #include <climits>
+#include <utility>
+#include <cstring>
 
-SequenceGenerator::SequenceGenerator(const std::vector<std::string>& colors, size_t initialLength)
-    : availableColors(colors), initialLength(initialLength), maxSequenceLength(50),
-      randomGenerator(std::random_device{}()) {
+const size_t SequenceGenerator::MAX_SYMBOLS;
+const uint8_t SequenceGenerator::INVALID_SYMBOL;
+const size_t SequenceGenerator::DEFAULT_MAX_LENGTH;
+const uint32_t SequenceGenerator::SNAPSHOT_MAGIC;
+const uint16_t SequenceGenerator::SNAPSHOT_VERSION;
+
+static_assert(sizeof(SequenceSnapshotHeader) == 72, "SequenceSnapshotHeader deve ter layout fixo");
+
+namespace {
+
+const uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
+const uint64_t FNV_PRIME = 0x100000001b3ULL;
+const uint8_t SNAPSHOT_FLAG_PACKED = 0x01;
+
+/**
+ * @brief Acumula palavras de 64 bits em um hash FNV-1a
+ */
+uint64_t fnvWords(uint64_t hash, const uint8_t* data, size_t words) {
+    for (size_t i = 0; i < words; ++i) {
+        uint64_t word;
+        std::memcpy(&word, data + i * sizeof(uint64_t), sizeof(word));
+        hash = (hash ^ word) * FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief Tamanho da área de contagens (múltiplo de 8 bytes)
+ */
+size_t countsAreaBytes(size_t alphabetSize) {
+    return (alphabetSize * sizeof(uint32_t) + 7) & ~static_cast<size_t>(7);
+}
+
+} // namespace
+
+SequenceGenerator::SequenceGenerator(const std::vector<std::string>& colors, size_t initialLength,
+                                     size_t maxSequenceLength)
+    : initialLength(initialLength), maxSequenceLength(maxSequenceLength),
+      packedStorage(false), rng(CounterRng::randomSeed()), uniqueSymbols(0), maxSymbolCount(0) {
     
-    validateConstructorParams();
-    distribution = std::uniform_int_distribution<int>(0, static_cast<int>(availableColors.size() - 1));
+    validateConstructorParams(colors);
     initializeSequence();
 }
 
-void SequenceGenerator::validateConstructorParams() {
-    if (availableColors.empty()) {
+void SequenceGenerator::validateConstructorParams(const std::vector<std::string>& colors) {
+    if (colors.empty()) {
         throw std::invalid_argument("SequenceGenerator: availableColors não pode estar vazio");
     }
     
@@ -31,61 +68,143 @@ void SequenceGenerator::validateConstructorParams() {
         throw std::invalid_argument("SequenceGenerator: initialLength deve ser um número positivo");
     }
     
-    // Verificar se não há cores duplicadas
-    std::vector<std::string> sortedColors = availableColors;
-    std::sort(sortedColors.begin(), sortedColors.end());
-    auto it = std::unique(sortedColors.begin(), sortedColors.end());
-    if (it != sortedColors.end()) {
+    if (maxSequenceLength < initialLength) {
+        throw std::invalid_argument("SequenceGenerator: maxSequenceLength não pode ser menor que initialLength");
+    }
+    
+    if (colors.size() > MAX_SYMBOLS) {
+        throw std::invalid_argument("SequenceGenerator: availableColors excede o número máximo de símbolos");
+    }
+    
+    std::shared_ptr<SymbolTable> table = std::make_shared<SymbolTable>();
+    if (!table->assign(colors)) {
         throw std::invalid_argument("SequenceGenerator: cores duplicadas não são permitidas");
     }
+    alphabet = table;
+}
+
+bool SequenceGenerator::isValidAlphabet(const std::vector<std::string>& colors) {
+    return !colors.empty() && SymbolTable::isValidSymbolSet(colors);
 }
 
 void SequenceGenerator::initializeSequence() {
-    currentSequence.clear();
+    clearSequence();
     for (size_t i = 0; i < initialLength; ++i) {
         addRandomElement();
     }
 }
 
-int SequenceGenerator::generateRandomIndex() {
-    return distribution(randomGenerator);
+void SequenceGenerator::clearSequence() {
+    currentSequence.clear();
+    symbolCounts.assign(alphabet->size(), 0);
+    uniqueSymbols = 0;
+    maxSymbolCount = 0;
+}
+
+void SequenceGenerator::appendSymbol(uint8_t symbolId) {
+    currentSequence.push_back(symbolId);
+
+    // Um objeto movido fica sem contadores; eles são recriados no primeiro uso
+    if (symbolId >= symbolCounts.size()) {
+        symbolCounts.resize(alphabet->size(), 0);
+    }
+    uint32_t count = ++symbolCounts[symbolId];
+    if (count == 1) {
+        uniqueSymbols++;
+    }
+    if (count > maxSymbolCount) {
+        maxSymbolCount = count;
+    }
+}
+
+uint8_t SequenceGenerator::symbolIdForIndex(uint64_t index) const {
+    return static_cast<uint8_t>(rng.boundedAt(index, static_cast<uint32_t>(alphabet->size())));
 }
 
 SequenceGenerator::SequenceGenerator(const SequenceGenerator& other)
-    : availableColors(other.availableColors),
+    : alphabet(other.alphabet),
       currentSequence(other.currentSequence),
       initialLength(other.initialLength),
       maxSequenceLength(other.maxSequenceLength),
-      randomGenerator(std::random_device{}()),
-      distribution(other.distribution) {
+      packedStorage(other.packedStorage),
+      rng(other.rng),
+      symbolCounts(other.symbolCounts),
+      uniqueSymbols(other.uniqueSymbols),
+      maxSymbolCount(other.maxSymbolCount) {
 }
 
 SequenceGenerator& SequenceGenerator::operator=(const SequenceGenerator& other) {
     if (this != &other) {
-        availableColors = other.availableColors;
+        alphabet = other.alphabet;
         currentSequence = other.currentSequence;
         initialLength = other.initialLength;
         maxSequenceLength = other.maxSequenceLength;
-        randomGenerator.seed(std::random_device{}());
-        distribution = other.distribution;
+        packedStorage = other.packedStorage;
+        rng = other.rng;
+        symbolCounts = other.symbolCounts;
+        uniqueSymbols = other.uniqueSymbols;
+        maxSymbolCount = other.maxSymbolCount;
+    }
+    return *this;
+}
+
+SequenceGenerator::SequenceGenerator(SequenceGenerator&& other) noexcept
+    : alphabet(other.alphabet),
+      currentSequence(std::move(other.currentSequence)),
+      initialLength(other.initialLength),
+      maxSequenceLength(other.maxSequenceLength),
+      packedStorage(other.packedStorage),
+      rng(other.rng),
+      symbolCounts(std::move(other.symbolCounts)),
+      uniqueSymbols(other.uniqueSymbols),
+      maxSymbolCount(other.maxSymbolCount) {
+    // O alfabeto continua compartilhado para que a origem permaneça utilizável;
+    // os contadores ficam vazios (sem alocar) e são recriados no primeiro uso
+    other.symbolCounts.clear();
+    other.uniqueSymbols = 0;
+    other.maxSymbolCount = 0;
+}
+
+SequenceGenerator& SequenceGenerator::operator=(SequenceGenerator&& other) noexcept {
+    if (this != &other) {
+        alphabet = other.alphabet;
+        currentSequence = std::move(other.currentSequence);
+        initialLength = other.initialLength;
+        maxSequenceLength = other.maxSequenceLength;
+        packedStorage = other.packedStorage;
+        rng = other.rng;
+        symbolCounts = std::move(other.symbolCounts);
+        uniqueSymbols = other.uniqueSymbols;
+        maxSymbolCount = other.maxSymbolCount;
+        other.symbolCounts.clear();
+        other.uniqueSymbols = 0;
+        other.maxSymbolCount = 0;
     }
     return *this;
 }
 
+SequenceGenerator SequenceGenerator::clone() const {
+    return SequenceGenerator(*this);
+}
+
 std::string SequenceGenerator::addRandomElement() {
     if (currentSequence.size() >= maxSequenceLength) {
         return "";
     }
     
-    int randomIndex = generateRandomIndex();
-    std::string newElement = availableColors[randomIndex];
-    currentSequence.push_back(newElement);
+    uint8_t symbolId = symbolIdForIndex(currentSequence.size());
+    appendSymbol(symbolId);
     
-    return newElement;
+    return alphabet->name(symbolId);
 }
 
 std::vector<std::string> SequenceGenerator::getCurrentSequence() const {
-    return currentSequence;
+    std::vector<std::string> sequence;
+    sequence.reserve(currentSequence.size());
+    for (size_t i = 0; i < currentSequence.size(); ++i) {
+        sequence.push_back(alphabet->name(currentSequence.get(i)));
+    }
+    return sequence;
 }
 
 size_t SequenceGenerator::getSequenceLength() const {
@@ -96,48 +215,101 @@ std::string SequenceGenerator::getElementAt(size_t index) const {
     if (index >= currentSequence.size()) {
         return "";
     }
-    return currentSequence[index];
+    return alphabet->name(currentSequence.get(index));
+}
+
+uint8_t SequenceGenerator::getSymbolIdAt(size_t index) const {
+    if (index >= currentSequence.size()) {
+        return INVALID_SYMBOL;
+    }
+    return currentSequence.get(index);
+}
+
+uint8_t SequenceGenerator::findSymbolId(const std::string& symbol) const {
+    return alphabet->find(symbol);
+}
+
+const std::string& SequenceGenerator::getSymbolName(uint8_t id) const {
+    return alphabet->name(id);
+}
+
+std::vector<uint8_t> SequenceGenerator::getSymbolIds() const {
+    return currentSequence.toIds();
+}
+
+const PackedSequence& SequenceGenerator::getPackedSequence() const {
+    return currentSequence;
+}
+
+unsigned SequenceGenerator::storageBitsPerSymbol() const {
+    return packedStorage ? PackedSequence::bitsForAlphabet(alphabet->size()) : 8;
+}
+
+void SequenceGenerator::setPackedStorage(bool enabled) {
+    packedStorage = enabled;
+    currentSequence.repack(storageBitsPerSymbol());
+}
+
+bool SequenceGenerator::isPackedStorage() const {
+    return packedStorage;
 }
 
 void SequenceGenerator::reset() {
+    rng.setSessionId(rng.getSessionId() + 1);
+    initializeSequence();
+}
+
+void SequenceGenerator::setSeed(uint64_t seed, uint64_t sessionId) {
+    rng.setSeed(seed);
+    rng.setSessionId(sessionId);
     initializeSequence();
 }
 
+uint64_t SequenceGenerator::getSeed() const {
+    return rng.getSeed();
+}
+
+uint64_t SequenceGenerator::getSessionId() const {
+    return rng.getSessionId();
+}
+
 bool SequenceGenerator::setCustomSequence(const std::vector<std::string>& sequence) {
+    if (sequence.size() > maxSequenceLength) {
+        return false;
+    }
+    
     // Validar que todos os elementos são cores válidas
+    std::vector<uint8_t> symbolIds;
+    symbolIds.reserve(sequence.size());
     for (const auto& element : sequence) {
-        if (std::find(availableColors.begin(), availableColors.end(), element) == availableColors.end()) {
+        uint8_t id = findSymbolId(element);
+        if (id == INVALID_SYMBOL) {
             return false;
         }
+        symbolIds.push_back(id);
     }
     
-    if (sequence.size() > maxSequenceLength) {
-        return false;
+    clearSequence();
+    for (uint8_t id : symbolIds) {
+        appendSymbol(id);
     }
-    
-    currentSequence = sequence;
     return true;
 }
 
 std::vector<std::string> SequenceGenerator::getAvailableColors() const {
-    return availableColors;
+    return alphabet->getSymbols();
 }
 
 bool SequenceGenerator::updateAvailableColors(const std::vector<std::string>& newColors) {
-    if (newColors.empty()) {
+    // A tabela detecta duplicatas na própria inserção e não muda se falhar
+    std::shared_ptr<SymbolTable> table = std::make_shared<SymbolTable>();
+    if (newColors.empty() || !table->assign(newColors)) {
         return false;
     }
     
-    // Verificar duplicatas
-    std::vector<std::string> sortedColors = newColors;
-    std::sort(sortedColors.begin(), sortedColors.end());
-    auto it = std::unique(sortedColors.begin(), sortedColors.end());
-    if (it != sortedColors.end()) {
-        return false;
-    }
-    
-    availableColors = newColors;
-    distribution = std::uniform_int_distribution<int>(0, static_cast<int>(availableColors.size() - 1));
+    // Cópias existentes mantêm o alfabeto anterior
+    alphabet = table;
+    currentSequence = PackedSequence(storageBitsPerSymbol());
     
     // Reiniciar sequência para usar novas cores
     reset();
@@ -145,8 +317,20 @@ bool SequenceGenerator::updateAvailableColors(const std::vector<std::string>& ne
 }
 
 std::string SequenceGenerator::previewNextElement() {
-    int randomIndex = generateRandomIndex();
-    return availableColors[randomIndex];
+    return alphabet->name(symbolIdForIndex(currentSequence.size()));
+}
+
+bool SequenceGenerator::setMaxSequenceLength(size_t maxLength) {
+    if (maxLength < initialLength || maxLength < currentSequence.size()) {
+        return false;
+    }
+    
+    maxSequenceLength = maxLength;
+    return true;
+}
+
+size_t SequenceGenerator::getMaxSequenceLength() const {
+    return maxSequenceLength;
 }
 
 bool SequenceGenerator::isAtMaxLength() const {
@@ -154,48 +338,41 @@ bool SequenceGenerator::isAtMaxLength() const {
 }
 
 std::map<std::string, int> SequenceGenerator::getSequenceStats() const {
+    SequenceStats typed = getStats();
     std::map<std::string, int> stats;
     
-    stats["length"] = static_cast<int>(currentSequence.size());
-    stats["maxLength"] = static_cast<int>(maxSequenceLength);
-    stats["uniqueColors"] = 0;
+    stats["length"] = static_cast<int>(typed.length);
+    stats["maxLength"] = static_cast<int>(typed.maxLength);
+    stats["uniqueColors"] = typed.uniqueColors;
+    stats["mostFrequentCount"] = typed.mostFrequentCount;
+    stats["leastFrequentCount"] = typed.uniqueColors > 0 ? typed.leastFrequentCount : INT_MAX;
     
-    // Contar ocorrências de cada cor
-    std::map<std::string, int> colorCounts;
-    for (const auto& color : availableColors) {
-        colorCounts[color] = 0;
-    }
-    
-    for (const auto& element : currentSequence) {
-        colorCounts[element]++;
-    }
-    
-    // Encontrar cor mais frequente e menos frequente
-    std::string mostFrequent, leastFrequent;
-    int maxCount = -1, minCount = INT_MAX;
+    return stats;
+}
+
+SequenceStats SequenceGenerator::getStats() const {
+    SequenceStats stats;
+    stats.length = currentSequence.size();
+    stats.maxLength = maxSequenceLength;
+    stats.uniqueColors = uniqueSymbols;
+    stats.mostFrequentCount = static_cast<int>(maxSymbolCount);
     
-    for (const auto& pair : colorCounts) {
-        if (pair.second > 0) {
-            stats["uniqueColors"]++;
-        }
-        
-        if (pair.second > maxCount) {
-            maxCount = pair.second;
-            mostFrequent = pair.first;
-        }
-        
-        if (pair.second < minCount && pair.second > 0) {
-            minCount = pair.second;
-            leastFrequent = pair.first;
+    // O menor valor não é incremental: uma varredura do alfabeto basta
+    uint32_t minCount = 0;
+    for (uint32_t count : symbolCounts) {
+        if (count > 0 && (minCount == 0 || count < minCount)) {
+            minCount = count;
         }
     }
-    
-    stats["mostFrequentCount"] = maxCount;
-    stats["leastFrequentCount"] = minCount;
+    stats.leastFrequentCount = static_cast<int>(minCount);
     
     return stats;
 }
 
+const std::vector<uint32_t>& SequenceGenerator::getSymbolCounts() const {
+    return symbolCounts;
+}
+
 std::string SequenceGenerator::toString(const std::string& separator) const {
     if (currentSequence.empty()) {
         return "";
@@ -206,7 +383,7 @@ std::string SequenceGenerator::toString(const std::string& separator) const {
         if (i > 0) {
             oss << separator;
         }
-        oss << currentSequence[i];
+        oss << alphabet->name(currentSequence.get(i));
     }
     
     return oss.str();
@@ -224,7 +401,7 @@ std::pair<bool, int> SequenceGenerator::validateUserSequence(const std::vector<s
             return std::make_pair(false, static_cast<int>(i));
         }
         
-        if (userSequence[i] != currentSequence[i]) {
+        if (findSymbolId(userSequence[i]) != currentSequence.get(i)) {
             return std::make_pair(false, static_cast<int>(i));
         }
     }
@@ -232,8 +409,196 @@ std::pair<bool, int> SequenceGenerator::validateUserSequence(const std::vector<s
     return std::make_pair(true, static_cast<int>(checkLength - 1));
 }
 
+std::pair<bool, int> SequenceGenerator::validateUserSequence(const std::vector<uint8_t>& userSymbolIds,
+                                                            int upToIndex) const {
+    size_t checkLength = userSymbolIds.size();
+    if (upToIndex >= 0) {
+        checkLength = std::min(checkLength, static_cast<size_t>(upToIndex + 1));
+    }
+    
+    size_t comparable = std::min(checkLength, currentSequence.size());
+    size_t position = 0;
+    while (position < comparable && userSymbolIds[position] == currentSequence.get(position)) {
+        position++;
+    }
+    
+    if (position < checkLength) {
+        return std::make_pair(false, static_cast<int>(position));
+    }
+    
+    return std::make_pair(true, static_cast<int>(checkLength - 1));
+}
+
+std::pair<bool, int> SequenceGenerator::validateUserSequence(const PackedSequence& userSequence,
+                                                            int upToIndex) const {
+    size_t checkLength = userSequence.size();
+    if (upToIndex >= 0) {
+        checkLength = std::min(checkLength, static_cast<size_t>(upToIndex + 1));
+    }
+    
+    size_t position = PackedSequence::firstMismatch(userSequence, currentSequence, checkLength);
+    if (position < checkLength) {
+        return std::make_pair(false, static_cast<int>(position));
+    }
+    
+    return std::make_pair(true, static_cast<int>(checkLength - 1));
+}
+
+uint64_t SequenceGenerator::getAlphabetId() const {
+    uint64_t hash = FNV_OFFSET;
+    for (const auto& color : alphabet->getSymbols()) {
+        for (char c : color) {
+            hash = (hash ^ static_cast<uint8_t>(c)) * FNV_PRIME;
+        }
+        hash = (hash ^ 0xFFu) * FNV_PRIME; // Separador entre símbolos
+    }
+    return hash;
+}
+
+size_t SequenceGenerator::getSnapshotSize() const {
+    return sizeof(SequenceSnapshotHeader) + countsAreaBytes(alphabet->size()) +
+           currentSequence.getStorageBytes();
+}
+
+size_t SequenceGenerator::writeSnapshot(uint8_t* buffer, size_t capacity) const {
+    size_t total = getSnapshotSize();
+    if (capacity < total) {
+        return 0;
+    }
+    
+    size_t countsBytes = countsAreaBytes(alphabet->size());
+    uint8_t* counts = buffer + sizeof(SequenceSnapshotHeader);
+    uint8_t* words = counts + countsBytes;
+    
+    std::memset(counts, 0, countsBytes);
+    std::memcpy(counts, symbolCounts.data(), symbolCounts.size() * sizeof(uint32_t));
+    
+    // Exportar diretamente ou via buffer alinhado se o destino não estiver alinhado
+    size_t wordCount = currentSequence.getStorageBytes() / sizeof(uint64_t);
+    if (reinterpret_cast<uintptr_t>(words) % alignof(uint64_t) == 0) {
+        currentSequence.exportWords(reinterpret_cast<uint64_t*>(words));
+    } else {
+        std::vector<uint64_t> aligned(wordCount);
+        currentSequence.exportWords(aligned.data());
+        std::memcpy(words, aligned.data(), wordCount * sizeof(uint64_t));
+    }
+    
+    SequenceSnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.bitsPerSymbol = static_cast<uint8_t>(currentSequence.getBitsPerSymbol());
+    header.flags = packedStorage ? SNAPSHOT_FLAG_PACKED : 0;
+    header.seed = rng.getSeed();
+    header.sessionId = rng.getSessionId();
+    header.alphabetId = getAlphabetId();
+    header.length = currentSequence.size();
+    header.maxSequenceLength = maxSequenceLength;
+    header.initialLength = initialLength;
+    header.alphabetSize = static_cast<uint32_t>(alphabet->size());
+    header.checksum = fnvWords(FNV_OFFSET, counts, (countsBytes + wordCount * sizeof(uint64_t)) / sizeof(uint64_t));
+    std::memcpy(buffer, &header, sizeof(header));
+    
+    return total;
+}
+
+std::vector<uint8_t> SequenceGenerator::snapshot() const {
+    std::vector<uint8_t> data(getSnapshotSize());
+    writeSnapshot(data.data(), data.size());
+    return data;
+}
+
+bool SequenceGenerator::restore(const uint8_t* data, size_t size) {
+    SequenceSnapshotHeader header;
+    if (data == nullptr || size < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    
+    if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION) {
+        return false;
+    }
+    
+    // O alfabeto não é gravado: exigir o mesmo alfabeto deste gerador
+    if (header.alphabetSize != alphabet->size() || header.alphabetId != getAlphabetId()) {
+        return false;
+    }
+    
+    bool packed = (header.flags & SNAPSHOT_FLAG_PACKED) != 0;
+    unsigned expectedBits = packed ? PackedSequence::bitsForAlphabet(alphabet->size()) : 8;
+    if (header.bitsPerSymbol != expectedBits || header.initialLength < 1 ||
+        header.initialLength > header.maxSequenceLength || header.length > header.maxSequenceLength) {
+        return false;
+    }
+    
+    size_t symbolsPerWord = 64 / expectedBits;
+    size_t wordCount = static_cast<size_t>((header.length + symbolsPerWord - 1) / symbolsPerWord);
+    size_t countsBytes = countsAreaBytes(alphabet->size());
+    if (size != sizeof(header) + countsBytes + wordCount * sizeof(uint64_t)) {
+        return false;
+    }
+    
+    const uint8_t* counts = data + sizeof(header);
+    const uint8_t* words = counts + countsBytes;
+    if (fnvWords(FNV_OFFSET, counts, (countsBytes + wordCount * sizeof(uint64_t)) / sizeof(uint64_t)) != header.checksum) {
+        return false;
+    }
+    
+    std::vector<uint32_t> restoredCounts(alphabet->size());
+    std::memcpy(restoredCounts.data(), counts, restoredCounts.size() * sizeof(uint32_t));
+    uint64_t total = 0;
+    int unique = 0;
+    uint32_t maxCount = 0;
+    for (uint32_t count : restoredCounts) {
+        total += count;
+        unique += count > 0 ? 1 : 0;
+        maxCount = std::max(maxCount, count);
+    }
+    if (total != header.length) {
+        return false;
+    }
+    
+    PackedSequence restored(expectedBits);
+    if (reinterpret_cast<uintptr_t>(words) % alignof(uint64_t) == 0) {
+        restored.importWords(reinterpret_cast<const uint64_t*>(words), static_cast<size_t>(header.length));
+    } else {
+        std::vector<uint64_t> aligned(wordCount);
+        std::memcpy(aligned.data(), words, wordCount * sizeof(uint64_t));
+        restored.importWords(aligned.data(), static_cast<size_t>(header.length));
+    }
+    
+    // A soma de verificação não garante coerência: conferir cada identificador
+    // e as contagens contra os elementos realmente gravados
+    std::vector<uint32_t> decodedCounts(alphabet->size(), 0);
+    for (size_t i = 0; i < restored.size(); ++i) {
+        uint8_t symbolId = restored.get(i);
+        if (symbolId >= decodedCounts.size()) {
+            return false;
+        }
+        ++decodedCounts[symbolId];
+    }
+    if (decodedCounts != restoredCounts) {
+        return false;
+    }
+    
+    currentSequence = std::move(restored);
+    symbolCounts.swap(restoredCounts);
+    uniqueSymbols = unique;
+    maxSymbolCount = maxCount;
+    initialLength = static_cast<size_t>(header.initialLength);
+    maxSequenceLength = static_cast<size_t>(header.maxSequenceLength);
+    packedStorage = packed;
+    rng.setSeed(header.seed);
+    rng.setSessionId(header.sessionId);
+    return true;
+}
+
+bool SequenceGenerator::restore(const std::vector<uint8_t>& data) {
+    return restore(data.data(), data.size());
+}
+
 bool SequenceGenerator::operator==(const SequenceGenerator& other) const {
-    return availableColors == other.availableColors &&
+    return (alphabet == other.alphabet || alphabet->getSymbols() == other.alphabet->getSymbols()) &&
            currentSequence == other.currentSequence &&
            initialLength == other.initialLength &&
            maxSequenceLength == other.maxSequenceLength;
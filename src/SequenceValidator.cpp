@@ -0,0 +1,60 @@
+/**
+ * @file SequenceValidator.cpp
+ * @brief Implementação da classe SequenceValidator
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "SequenceValidator.h"
+
+namespace {
+const std::string emptySymbol;
+}
+
+SequenceValidator::SequenceValidator(const SequenceGenerator& generator)
+    : generator(&generator), cursor(0) {
+}
+
+ValidationResult SequenceValidator::advance(uint8_t symbolId) {
+    if (cursor >= generator->getSequenceLength() ||
+        generator->getSymbolIdAt(cursor) != symbolId) {
+        return ValidationResult::WRONG;
+    }
+
+    cursor++;
+    return isComplete() ? ValidationResult::COMPLETE : ValidationResult::CORRECT;
+}
+
+ValidationResult SequenceValidator::advance(const std::string& symbol) {
+    if (cursor >= generator->getSequenceLength() ||
+        generator->getSymbolName(generator->getSymbolIdAt(cursor)) != symbol) {
+        return ValidationResult::WRONG;
+    }
+
+    cursor++;
+    return isComplete() ? ValidationResult::COMPLETE : ValidationResult::CORRECT;
+}
+
+void SequenceValidator::reset() {
+    cursor = 0;
+}
+
+size_t SequenceValidator::getPosition() const {
+    return cursor;
+}
+
+uint8_t SequenceValidator::getExpectedSymbolId() const {
+    return generator->getSymbolIdAt(cursor);
+}
+
+const std::string& SequenceValidator::getExpectedSymbol() const {
+    if (cursor >= generator->getSequenceLength()) {
+        return emptySymbol;
+    }
+    return generator->getSymbolName(generator->getSymbolIdAt(cursor));
+}
+
+bool SequenceValidator::isComplete() const {
+    return cursor >= generator->getSequenceLength();
+}
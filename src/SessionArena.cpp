@@ -0,0 +1,104 @@
+/**
+ * @file SessionArena.cpp
+ * @brief Implementação da classe SessionArena
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "SessionArena.h"
+#include <algorithm>
+
+const size_t SessionArena::DEFAULT_BLOCK_SIZE;
+
+namespace {
+
+/// Deslocamento dos dados em relação ao início do bloco (preserva o alinhamento do operator new)
+const size_t HEADER_SIZE = (sizeof(void*) + sizeof(size_t) + alignof(std::max_align_t) - 1) /
+                           alignof(std::max_align_t) * alignof(std::max_align_t);
+
+} // namespace
+
+SessionArena::SessionArena(size_t blockSize)
+    : current(nullptr), cursor(nullptr), limit(nullptr), finalizers(nullptr),
+      blockSize(std::max<size_t>(blockSize, 256)), blockCount(0), capacity(0),
+      bytesUsed(0), objectCount(0) {
+}
+
+SessionArena::~SessionArena() {
+    // Sem release(): ele poderia alocar o bloco consolidado só para liberá-lo
+    destroyObjects();
+    freeBlocks();
+}
+
+void SessionArena::addBlock(size_t dataSize) {
+    static_assert(sizeof(Block) <= HEADER_SIZE, "Cabeçalho do bloco maior que o reservado");
+
+    Block* block = static_cast<Block*>(::operator new(HEADER_SIZE + dataSize));
+    block->previous = current;
+    block->size = dataSize;
+
+    current = block;
+    cursor = reinterpret_cast<char*>(block) + HEADER_SIZE;
+    limit = cursor + dataSize;
+    blockCount++;
+    capacity += dataSize;
+}
+
+void* SessionArena::allocateSlow(size_t size, size_t alignment) {
+    // Requisições maiores que um bloco recebem um bloco próprio
+    addBlock(std::max(blockSize, size + alignment));
+    return allocate(size, alignment);
+}
+
+void SessionArena::freeBlocks() {
+    while (current != nullptr) {
+        Block* previous = current->previous;
+        ::operator delete(current);
+        current = previous;
+    }
+    cursor = nullptr;
+    limit = nullptr;
+    blockCount = 0;
+    capacity = 0;
+}
+
+void SessionArena::destroyObjects() {
+    // Ordem inversa de criação: objetos criados depois podem depender dos anteriores
+    while (finalizers != nullptr) {
+        Finalizer* finalizer = finalizers;
+        finalizers = finalizer->previous;
+        finalizer->destroy(finalizer->object);
+    }
+    objectCount = 0;
+    bytesUsed = 0;
+}
+
+void SessionArena::release() {
+    destroyObjects();
+
+    if (blockCount > 1) {
+        // Um único bloco com a capacidade total atende a próxima sessão sem novas alocações
+        size_t total = capacity;
+        freeBlocks();
+        addBlock(total);
+    } else if (current != nullptr) {
+        cursor = reinterpret_cast<char*>(current) + HEADER_SIZE;
+    }
+}
+
+size_t SessionArena::getBytesUsed() const {
+    return bytesUsed;
+}
+
+size_t SessionArena::getCapacity() const {
+    return capacity;
+}
+
+size_t SessionArena::getBlockCount() const {
+    return blockCount;
+}
+
+size_t SessionArena::getObjectCount() const {
+    return objectCount;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file SimonEngine.cpp
+ * @brief Implementação da classe SimonEngine
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "SimonEngine.h"
+#include <map>
+
+SimonEngine::SimonEngine(SequenceGenerator& generator, Player& player, ScoreManager* scoreManager)
+    : sequenceGenerator(&generator), player(&player), scoreManager(scoreManager),
+      phase(EnginePhase::IDLE), validator(generator) {
+    events.reserve(8);
+}
+
+void SimonEngine::emit(EngineEventType type, int position, int value,
+                       const std::string& symbol, const std::string& expected) {
+    events.push_back(EngineEvent(type, position, value, symbol, expected));
+}
+
+const std::vector<EngineEvent>& SimonEngine::startGame(const std::string& playerName) {
+    events.clear();
+
+    if (!playerName.empty()) {
+        player->setName(playerName);
+    }
+    player->startGame();
+    sequenceGenerator->reset();
+
+    startRound();
+    return events;
+}
+
+void SimonEngine::startRound() {
+    // Gerar próximo elemento na sequência
+    if (sequenceGenerator->addRandomElement().empty()) {
+        // Sequência máxima atingida - vitória!
+        finishGame(EngineEventType::GAME_COMPLETE);
+        return;
+    }
+
+    beginInput(EngineEventType::ROUND_STARTED);
+}
+
+void SimonEngine::beginInput(EngineEventType type) {
+    phase = EnginePhase::WAITING_INPUT;
+    validator.reset();
+    player->startInputSequence();
+    emit(type, static_cast<int>(sequenceGenerator->getSequenceLength()));
+}
+
+const std::vector<EngineEvent>& SimonEngine::step(const std::string& input) {
+    events.clear();
+
+    if (phase != EnginePhase::WAITING_INPUT) {
+        return events;
+    }
+
+    player->addInput(input);
+
+    int position = static_cast<int>(validator.getPosition());
+    const std::string& expected = validator.getExpectedSymbol();
+    ValidationResult result = validator.advance(input);
+
+    if (result == ValidationResult::WRONG) {
+        emit(EngineEventType::INPUT_WRONG, position, 0, input, expected);
+        if (applyPenalty("Sequencia incorreta")) {
+            // Mostrar a mesma sequência novamente
+            beginInput(EngineEventType::ROUND_RESTARTED);
+        }
+        return events;
+    }
+
+    emit(EngineEventType::INPUT_CORRECT, position, 0, input, expected);
+
+    if (result == ValidationResult::COMPLETE) {
+        completeSequence();
+    }
+
+    return events;
+}
+
+void SimonEngine::completeSequence() {
+    int sequenceLength = static_cast<int>(sequenceGenerator->getSequenceLength());
+    int previousScore = player->getScore();
+
+    player->recordSuccessfulSequence(sequenceLength);
+    player->advanceLevel();
+
+    emit(EngineEventType::SEQUENCE_COMPLETE, sequenceLength, player->getScore() - previousScore);
+
+    // Verificar se atingiu nível máximo
+    if (sequenceGenerator->isAtMaxLength()) {
+        finishGame(EngineEventType::GAME_COMPLETE);
+        return;
+    }
+
+    startRound();
+}
+
+bool SimonEngine::applyPenalty(const std::string& reason) {
+    bool stillAlive = player->loseLife(reason);
+    emit(EngineEventType::LIFE_LOST, static_cast<int>(validator.getPosition()), player->getLives());
+
+    if (!stillAlive) {
+        finishGame(EngineEventType::GAME_OVER);
+    }
+
+    return stillAlive;
+}
+
+const std::vector<EngineEvent>& SimonEngine::revealSequence() {
+    events.clear();
+
+    if (phase == EnginePhase::WAITING_INPUT) {
+        applyPenalty("Revelou a sequencia");
+    }
+
+    return events;
+}
+
+void SimonEngine::finishGame(EngineEventType type) {
+    phase = (type == EngineEventType::GAME_OVER) ? EnginePhase::GAME_OVER : EnginePhase::GAME_COMPLETE;
+    player->endGame();
+
+    emit(type, static_cast<int>(sequenceGenerator->getSequenceLength()), player->getScore());
+    recordScore();
+}
+
+void SimonEngine::recordScore() {
+    if (scoreManager == nullptr || player->getScore() <= 0) {
+        return;
+    }
+
+    PlayerStats playerStats = player->getStats();
+
+    std::map<std::string, std::string> additionalData;
+    additionalData["level"] = std::to_string(playerStats.level);
+    additionalData["accuracy"] = Player::formatAccuracy(playerStats.accuracy);
+    additionalData["duration"] = std::to_string(playerStats.gameDuration);
+    additionalData["streak"] = std::to_string(playerStats.bestStreak);
+
+    auto result = scoreManager->addScore(player->getName(), player->getScore(), additionalData);
+
+    if (result["success"] != "true") {
+        emit(EngineEventType::SCORE_REJECTED);
+        return;
+    }
+
+    if (result["saved"] != "true") {
+        scoreManager->forceSave();
+    }
+
+    emit(EngineEventType::SCORE_SAVED, 0, std::stoi(result["rank"]));
+    if (result["isNewRecord"] == "true") {
+        emit(EngineEventType::NEW_RECORD, 0, player->getScore());
+    }
+}
+
+const std::vector<EngineEvent>& SimonEngine::saveScore() {
+    events.clear();
+    recordScore();
+    return events;
+}
+
+void SimonEngine::abandonGame() {
+    events.clear();
+    phase = EnginePhase::IDLE;
+    validator.reset();
+}
+
+EnginePhase SimonEngine::getPhase() const {
+    return phase;
+}
+
+size_t SimonEngine::getInputIndex() const {
+    return validator.getPosition();
+}
+
+bool SimonEngine::isWaitingInput() const {
+    return phase == EnginePhase::WAITING_INPUT;
+}
+
+bool SimonEngine::isFinished() const {
+    return phase == EnginePhase::GAME_OVER || phase == EnginePhase::GAME_COMPLETE;
+}
@@ -24,7 +24,7 @@
 #endif
 
 SimonGame::SimonGame() 
-    : currentState(GameState::MENU), gameRunning(true), currentSequenceIndex(0),
+    : currentState(GameState::MENU), gameRunning(true),
       maxInputTime(5000), sequenceSpeed(1000), minSequenceSpeed(300), 
       speedDecrement(50), soundEnabled(true) {
     
@@ -41,6 +41,7 @@ void SimonGame::initializeComponents() {
         std::vector<std::string>{"A", "B", "C", "D"}, 1));
     player.reset(new Player("Jogador", 3));
     scoreManager.reset(new ScoreManager(10, "scores.dat"));
+    engine.reset(new SimonEngine(*sequenceGenerator, *player, scoreManager.get()));
     
     // Inicializar estatísticas
     gameAnalytics["totalGamesPlayed"] = 0;
@@ -73,15 +74,15 @@ void SimonGame::displayGameHeader() {
 }
 
 void SimonGame::displayPlayerStats() {
-    auto stats = player->getStatistics();
-    
-    std::cout << "👤 Jogador: " << stats["name"] << "\n";
-    std::cout << "🏆 Pontuacao: " << stats["score"] << "\n";
-    std::cout << "📊 Nivel: " << stats["level"] << "\n";
-    std::cout << "❤️  Vidas: " << stats["lives"] << "/" << stats["maxLives"] << "\n";
-    std::cout << "🔥 Sequencia Atual: " << stats["currentStreak"] << "\n";
-    std::cout << "⏱️  Tempo: " << stats["formattedDuration"] << "\n";
-    std::cout << "🎯 Precisao: " << stats["accuracy"] << "%\n";
+    PlayerStats stats = player->getStats();
+    
+    std::cout << "👤 Jogador: " << player->getName() << "\n";
+    std::cout << "🏆 Pontuacao: " << stats.score << "\n";
+    std::cout << "📊 Nivel: " << stats.level << "\n";
+    std::cout << "❤️  Vidas: " << stats.lives << "/" << stats.maxLives << "\n";
+    std::cout << "🔥 Sequencia Atual: " << stats.currentStreak << "\n";
+    std::cout << "⏱️  Tempo: " << player->getFormattedGameDuration() << "\n";
+    std::cout << "🎯 Precisao: " << Player::formatAccuracy(stats.accuracy) << "%\n";
     std::cout << "-----------------------------------------------\n\n";
 }
 
@@ -137,36 +138,27 @@ void SimonGame::waitForEnter() {
 }
 
 std::string SimonGame::getValidInput(const std::string& prompt, 
-                                   const std::vector<std::string>& validInputs) {
+                                   const SymbolTable& validInputs) {
     std::string input;
-    bool valid = false;
     
-    while (!valid) {
+    while (true) {
         std::cout << prompt;
         std::getline(std::cin, input);
         
-        // Converter para maiúscula
-        std::transform(input.begin(), input.end(), input.begin(), ::toupper);
-        
-        // Verificar se é entrada válida
-        for (const auto& validInput : validInputs) {
-            if (input == validInput) {
-                valid = true;
-                break;
-            }
+        // Busca O(1) já normalizando para maiúscula
+        uint8_t id = validInputs.find(input);
+        if (id != SymbolTable::NOT_FOUND) {
+            return validInputs.name(id);
         }
         
-        if (!valid) {
-            std::cout << "❌ Entrada invalida! Opcoes validas: ";
-            for (size_t i = 0; i < validInputs.size(); ++i) {
-                std::cout << validInputs[i];
-                if (i < validInputs.size() - 1) std::cout << ", ";
-            }
-            std::cout << "\n\n";
+        const auto& options = validInputs.getSymbols();
+        std::cout << "❌ Entrada invalida! Opcoes validas: ";
+        for (size_t i = 0; i < options.size(); ++i) {
+            std::cout << options[i];
+            if (i < options.size() - 1) std::cout << ", ";
         }
+        std::cout << "\n\n";
     }
-    
-    return input;
 }
 
 void SimonGame::updateSequenceSpeed() {
@@ -213,8 +205,8 @@ void SimonGame::showMainMenu() {
     std::cout << "4. ℹ️  Creditos\n";
     std::cout << "5. 🚪 Sair\n\n";
     
-    std::string choice = getValidInput("👉 Escolha uma opcao (1-5): ", 
-                                     {"1", "2", "3", "4", "5"});
+    static const SymbolTable menuOptions({"1", "2", "3", "4", "5"}, true);
+    std::string choice = getValidInput("👉 Escolha uma opcao (1-5): ", menuOptions);
     
     switch (choice[0]) {
         case '1': {
@@ -243,46 +235,23 @@ void SimonGame::showMainMenu() {
 bool SimonGame::startNewGame(const std::string& playerName) {
     try {
         currentState = GameState::PLAYING;
-        
-        // Configurar jogador
-        player->setName(playerName);
-        player->startGame();
-        
-        // Resetar componentes
-        sequenceGenerator->reset();
         sequenceSpeed = 1000;
-        currentSequenceIndex = 0;
         
         // Atualizar estatísticas
         gameAnalytics["totalGamesPlayed"]++;
         
-        std::cout << "\n🚀 Iniciando novo jogo para " << playerName << "!\n";
+        const auto& events = engine->startGame(playerName);
+        
+        std::cout << "\n🚀 Iniciando novo jogo para " << player->getName() << "!\n";
         waitForEnter();
         
+        renderEvents(events);
+        
         // Loop principal do jogo
-        while (currentState == GameState::PLAYING && player->isAlive()) {
-            clearScreen();
-            displayGameHeader();
-            displayPlayerStats();
-            
-            // Gerar próximo elemento na sequência
-            std::string newElement = sequenceGenerator->addRandomElement();
-            if (newElement.empty()) {
-                // Sequência máxima atingida - vitória!
-                handleGameComplete();
-                break;
-            }
-            
-            
-            // Mostrar sequência ao jogador
-            showSequenceToPlayer();
-            
-            // Aguardar entrada do jogador
-            waitForPlayerInput();
-        }
+        waitForPlayerInput();
         
-        if (!player->isAlive()) {
-            handleGameOver();
+        if (engine->isFinished()) {
+            waitForEnter();
         }
         
         return true;
@@ -313,71 +282,117 @@ void SimonGame::showSequenceToPlayer() {
     displayPlayerStats();
     std::cout << "🔥 Agora é sua vez! A sequencia foi mostrada.\n";
     std::cout << "🧠 Confie na sua memoria!\n\n";
+    
+    currentState = GameState::WAITING_INPUT;
 }
 
-void SimonGame::waitForPlayerInput() {
-    currentState = GameState::WAITING_INPUT;
-    currentSequenceIndex = 0;
-    
-    player->startInputSequence();
-    auto targetSequence = sequenceGenerator->getCurrentSequence();
-    
-    std::cout << "🎯 SUA VEZ! Repita a sequencia de " << targetSequence.size() << " elementos:\n\n";
+void SimonGame::displayInputPrompt() {
+    std::cout << "🎯 SUA VEZ! Repita a sequencia de " << sequenceGenerator->getSequenceLength() << " elementos:\n\n";
     std::cout << "📝 Opcoes disponiveis: A, B, C, D\n";
     std::cout << "🚪 Digite 'SAIR' para voltar ao menu\n";
     std::cout << "🔄 Digite 'REVELAR' se quiser ver a sequencia novamente (penalidade: -1 vida)\n\n";
     std::cout << "💡 Sua entrada ate agora: ";
-    
-    for (size_t i = 0; i < targetSequence.size(); ++i) {
-        std::cout << "\n🎯 Elemento " << (i + 1) << "/" << targetSequence.size() << ": ";
+}
+
+void SimonGame::waitForPlayerInput() {
+    while (engine->isWaitingInput()) {
+        size_t index = engine->getInputIndex();
+        size_t length = sequenceGenerator->getSequenceLength();
+        std::cout << "\n🎯 Elemento " << (index + 1) << "/" << length << ": ";
         
-        std::string input = getValidInput("", {"A", "B", "C", "D", "SAIR", "REVELAR"});
+        static const SymbolTable gameOptions({"A", "B", "C", "D", "SAIR", "REVELAR"}, true);
+        std::string input = getValidInput("", gameOptions);
         
         if (input == "SAIR") {
+            engine->abandonGame();
             currentState = GameState::MENU;
             return;
         }
         
         if (input == "REVELAR") {
             std::cout << "\n⚠️  PENALIDADE: Voce perdeu uma vida por revelar a sequencia!\n";
-            player->loseLife("Revelou a sequencia");
-            
-            std::cout << "🔍 Sequencia completa: ";
-            for (size_t j = 0; j < targetSequence.size(); ++j) {
-                std::cout << "[" << targetSequence[j] << "]";
-                if (j < targetSequence.size() - 1) std::cout << " -> ";
-            }
-            std::cout << "\n\n";
+            renderEvents(engine->revealSequence());
             
-            if (!player->isAlive()) {
-                handleGameOver();
+            if (!engine->isWaitingInput()) {
                 return;
             }
             
+            std::cout << "🔍 Sequencia completa: " << sequenceGenerator->toString(" -> ") << "\n\n";
             std::cout << "🔄 Continue de onde parou...\n";
             std::cout << "💡 Sua entrada ate agora: ";
-            for (size_t j = 0; j < i; ++j) {
-                std::cout << "[" << targetSequence[j] << "] ";
+            for (size_t j = 0; j < index; ++j) {
+                std::cout << "[" << sequenceGenerator->getElementAt(j) << "] ";
             }
             continue;
         }
         
-        player->addInput(input);
-        
         // Mostrar progresso sem revelar a sequência completa
         std::cout << "[" << input << "] ";
         
-        // Verificar se a entrada está correta
-        if (input == targetSequence[i]) {
-            handleCorrectInput(input);
-        } else {
-            handleIncorrectInput(input, targetSequence[i]);
-            return;
+        renderEvents(engine->step(input));
+    }
+}
+
+void SimonGame::renderEvents(const std::vector<EngineEvent>& events) {
+    for (const auto& event : events) {
+        switch (event.type) {
+            case EngineEventType::ROUND_STARTED:
+                clearScreen();
+                displayGameHeader();
+                displayPlayerStats();
+                showSequenceToPlayer();
+                displayInputPrompt();
+                break;
+                
+            case EngineEventType::ROUND_RESTARTED:
+                std::cout << "🔄 Tente novamente...\n";
+                waitForEnter();
+                
+                // Mostrar sequência novamente
+                showSequenceToPlayer();
+                displayInputPrompt();
+                break;
+                
+            case EngineEventType::INPUT_CORRECT:
+                handleCorrectInput(event.symbol);
+                break;
+                
+            case EngineEventType::INPUT_WRONG:
+                handleIncorrectInput(event.symbol, event.expected);
+                break;
+                
+            case EngineEventType::LIFE_LOST:
+                if (event.value > 0) {
+                    std::cout << "💔 Voce perdeu uma vida! Vidas restantes: " << event.value << "\n";
+                }
+                break;
+                
+            case EngineEventType::SEQUENCE_COMPLETE:
+                handleSequenceComplete(event.value);
+                break;
+                
+            case EngineEventType::GAME_OVER:
+                handleGameOver();
+                break;
+                
+            case EngineEventType::GAME_COMPLETE:
+                handleGameComplete();
+                break;
+                
+            case EngineEventType::SCORE_SAVED:
+                std::cout << "💾 Pontuacao salva!\n";
+                std::cout << "🏆 Posicao no ranking: #" << event.value << "\n\n";
+                break;
+                
+            case EngineEventType::NEW_RECORD:
+                std::cout << "🎉 NOVO RECORDE! Parabens!\n\n";
+                break;
+                
+            case EngineEventType::SCORE_REJECTED:
+                std::cout << "❌ Erro ao salvar pontuacao!\n\n";
+                break;
         }
     }
-    
-    // Se chegou aqui, completou a sequência
-    handleSequenceComplete();
 }
 
 void SimonGame::handleCorrectInput(const std::string& input) {
@@ -391,27 +406,9 @@ void SimonGame::handleCorrectInput(const std::string& input) {
 void SimonGame::handleIncorrectInput(const std::string& input, const std::string& expected) {
     std::cout << "❌ Incorreto! Voce digitou [" << input 
               << "] mas era [" << expected << "]\n";
-    
-    bool stillAlive = player->loseLife("Sequencia incorreta");
-    
-    if (stillAlive) {
-        std::cout << "💔 Voce perdeu uma vida! Vidas restantes: " 
-                  << player->getLives() << "\n";
-        std::cout << "🔄 Tente novamente...\n";
-        waitForEnter();
-        
-        // Mostrar sequência novamente
-        showSequenceToPlayer();
-        waitForPlayerInput();
-    } else {
-        currentState = GameState::GAME_OVER;
-    }
 }
 
-void SimonGame::handleSequenceComplete() {
-    int sequenceLength = static_cast<int>(sequenceGenerator->getSequenceLength());
-    player->recordSuccessfulSequence(sequenceLength);
-    player->advanceLevel();
+void SimonGame::handleSequenceComplete(int pointsEarned) {
     updateSequenceSpeed();
     
     gameAnalytics["totalSequencesCompleted"]++;
@@ -420,28 +417,23 @@ void SimonGame::handleSequenceComplete() {
         gameAnalytics["bestLevel"] = player->getLevel();
     }
     
-    auto stats = player->getStatistics();
-    int currentStreak = std::stoi(stats["currentStreak"]);
+    int currentStreak = player->getStats().currentStreak;
     if (currentStreak > gameAnalytics["longestStreak"]) {
         gameAnalytics["longestStreak"] = currentStreak;
     }
     
     std::cout << "\n🎉 SEQUENCIA COMPLETA!\n";
-    std::cout << "📈 Pontos ganhos: " << (sequenceLength * 10) << "\n";
+    std::cout << "📈 Pontos ganhos: " << pointsEarned << "\n";
     std::cout << "🔥 Sequencia de acertos: " << currentStreak << "\n";
     
-    // Verificar se atingiu nível máximo
-    if (sequenceGenerator->isAtMaxLength()) {
-        handleGameComplete();
-        return;
+    // Na vitória a tela final é mostrada logo em seguida
+    if (!sequenceGenerator->isAtMaxLength()) {
+        waitForEnter();
     }
-    
-    waitForEnter();
 }
 
 void SimonGame::handleGameComplete() {
     currentState = GameState::GAME_OVER;
-    player->endGame();
     
     clearScreen();
     displayGameHeader();
@@ -451,14 +443,10 @@ void SimonGame::handleGameComplete() {
     
     std::cout << "🌟 Voce e um MESTRE do Simon!\n";
     std::cout << "🥇 Pontuacao maxima alcancada!\n\n";
-    
-    saveCurrentScore();
-    waitForEnter();
 }
 
 void SimonGame::handleGameOver() {
     currentState = GameState::GAME_OVER;
-    player->endGame();
     
     clearScreen();
     displayGameHeader();
@@ -466,15 +454,15 @@ void SimonGame::handleGameOver() {
     std::cout << "💀 GAME OVER!\n\n";
     displayPlayerStats();
     
-    auto stats = player->getStatistics();
+    PlayerStats stats = player->getStats();
     std::cout << "📊 Estatisticas finais:\n";
-    std::cout << "   • Sequencias corretas: " << stats["totalCorrectSequences"] << "\n";
-    std::cout << "   • Melhor sequencia: " << stats["bestStreak"] << "\n";
-    std::cout << "   • Precisao: " << stats["accuracy"] << "%\n";
-    std::cout << "   • Tempo de reacao medio: " << stats["averageReactionTime"] << "ms\n\n";
-    
-    saveCurrentScore();
-    waitForEnter();
+    std::cout << "   • Sequencias corretas: " << stats.totalCorrectSequences << "\n";
+    std::cout << "   • Melhor sequencia: " << stats.bestStreak << "\n";
+    std::cout << "   • Precisao: " << Player::formatAccuracy(stats.accuracy) << "%\n";
+    std::cout << "   • Tempo de reacao medio: " << static_cast<int>(stats.averageReactionTime) << "ms\n";
+    std::cout << "   • Tempo de reacao p50/p90/p99: " << static_cast<int>(stats.reactionTimeP50) << "/"
+              << static_cast<int>(stats.reactionTimeP90) << "/"
+              << static_cast<int>(stats.reactionTimeP99) << "ms\n\n";
 }
 
 void SimonGame::showHighScores() {
@@ -552,8 +540,8 @@ void SimonGame::showSettings() {
     std::cout << "5. 🔄 Limpar recordes\n";
     std::cout << "6. 🔙 Voltar ao menu\n\n";
     
-    std::string choice = getValidInput("👉 Escolha uma opcao (1-6): ", 
-                                     {"1", "2", "3", "4", "5", "6"});
+    static const SymbolTable settingsOptions({"1", "2", "3", "4", "5", "6"}, true);
+    std::string choice = getValidInput("👉 Escolha uma opcao (1-6): ", settingsOptions);
     
     switch (choice[0]) {
         case '1':
@@ -618,7 +606,8 @@ void SimonGame::showSettings() {
         
         case '5': {
             std::cout << "\n⚠️ ATENCAO: Isso apagara TODOS os recordes!\n";
-            std::string confirm = getValidInput("Tem certeza? (S/N): ", {"S", "N"});
+            static const SymbolTable confirmOptions({"S", "N"}, true);
+            std::string confirm = getValidInput("Tem certeza? (S/N): ", confirmOptions);
             if (confirm == "S") {
                 if (scoreManager->clearScores()) {
                     std::cout << "✅ Recordes limpos com sucesso!\n";
@@ -640,35 +629,15 @@ void SimonGame::showSettings() {
 }
 
 bool SimonGame::saveCurrentScore() {
-    auto playerStats = player->getStatistics();
-    int score = std::stoi(playerStats["score"]);
-    
-    if (score <= 0) {
-        return false;
-    }
-    
-    std::map<std::string, std::string> additionalData;
-    additionalData["level"] = playerStats["level"];
-    additionalData["accuracy"] = playerStats["accuracy"];
-    additionalData["duration"] = playerStats["gameDuration"];
-    additionalData["streak"] = playerStats["bestStreak"];
-    
-    auto result = scoreManager->addScore(player->getName(), score, additionalData);
-    
-    if (result["success"] == "true") {
-        if (result["saved"] != "true") {
-            scoreManager->forceSave();
-        }
-        std::cout << "💾 Pontuacao salva!\n";
-        if (result["isNewRecord"] == "true") {
-            std::cout << "🎉 NOVO RECORDE! Parabens!\n";
+    bool saved = false;
+    const auto& events = engine->saveScore();
+    for (const auto& event : events) {
+        if (event.type == EngineEventType::SCORE_SAVED) {
+            saved = true;
         }
-        std::cout << "🏆 Posicao no ranking: #" << result["rank"] << "\n\n";
-        return true;
-    } else {
-        std::cout << "❌ Erro ao salvar pontuacao: " << result["error"] << "\n\n";
-        return false;
     }
+    renderEvents(events);
+    return saved;
 }
 
 GameState SimonGame::getCurrentState() const {
@@ -686,13 +655,11 @@ std::map<std::string, std::string> SimonGame::getCurrentPlayerStats() const {
 std::map<std::string, std::string> SimonGame::getCurrentSequenceInfo() const {
     std::map<std::string, std::string> info;
     
-    auto sequence = sequenceGenerator->getCurrentSequence();
-    info["length"] = std::to_string(sequence.size());
+    SequenceStats stats = sequenceGenerator->getStats();
+    info["length"] = std::to_string(stats.length);
     info["sequence"] = sequenceGenerator->toString();
     info["isAtMaxLength"] = sequenceGenerator->isAtMaxLength() ? "true" : "false";
-    
-    auto stats = sequenceGenerator->getSequenceStats();
-    info["uniqueColors"] = std::to_string(stats["uniqueColors"]);
+    info["uniqueColors"] = std::to_string(stats.uniqueColors);
     
     return info;
 }
@@ -713,27 +680,13 @@ bool SimonGame::togglePause() {
 }
 
 bool SimonGame::processPlayerInput(const std::string& input) {
-    if (currentState != GameState::WAITING_INPUT) {
-        return false;
-    }
-    
-    auto targetSequence = sequenceGenerator->getCurrentSequence();
-    if (static_cast<size_t>(currentSequenceIndex) >= targetSequence.size()) {
+    if (!engine->isWaitingInput()) {
         return false;
     }
     
-    bool correct = (input == targetSequence[currentSequenceIndex]);
-    
-    if (correct) {
-        handleCorrectInput(input);
-        currentSequenceIndex++;
-        
-        if (static_cast<size_t>(currentSequenceIndex) >= targetSequence.size()) {
-            handleSequenceComplete();
-        }
-    } else {
-        handleIncorrectInput(input, targetSequence[currentSequenceIndex]);
-    }
+    const auto& events = engine->step(input);
+    bool correct = !events.empty() && events.front().type == EngineEventType::INPUT_CORRECT;
+    renderEvents(events);
     
     return correct;
 }
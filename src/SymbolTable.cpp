@@ -0,0 +1,113 @@
+/**
+ * @file SymbolTable.cpp
+ * @brief Implementação da classe SymbolTable
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "SymbolTable.h"
+#include <stdexcept>
+#include <cstring>
+
+const size_t SymbolTable::MAX_SYMBOLS;
+const uint8_t SymbolTable::NOT_FOUND;
+
+SymbolTable::SymbolTable(bool caseInsensitive)
+    : caseInsensitive(caseInsensitive) {
+    std::memset(byteLookup, NOT_FOUND, sizeof(byteLookup));
+}
+
+SymbolTable::SymbolTable(const std::vector<std::string>& symbols, bool caseInsensitive)
+    : caseInsensitive(caseInsensitive) {
+    std::memset(byteLookup, NOT_FOUND, sizeof(byteLookup));
+    if (!assign(symbols)) {
+        throw std::invalid_argument("SymbolTable: símbolos inválidos ou duplicados");
+    }
+}
+
+unsigned char SymbolTable::fold(unsigned char c) const {
+    if (caseInsensitive && c >= 'a' && c <= 'z') {
+        return static_cast<unsigned char>(c - 'a' + 'A');
+    }
+    return c;
+}
+
+std::string SymbolTable::fold(const std::string& symbol) const {
+    if (!caseInsensitive) {
+        return symbol;
+    }
+    std::string folded(symbol);
+    for (char& c : folded) {
+        c = static_cast<char>(fold(static_cast<unsigned char>(c)));
+    }
+    return folded;
+}
+
+bool SymbolTable::assign(const std::vector<std::string>& newSymbols) {
+    if (newSymbols.size() > MAX_SYMBOLS) {
+        return false;
+    }
+
+    uint8_t newByteLookup[256];
+    std::memset(newByteLookup, NOT_FOUND, sizeof(newByteLookup));
+    std::unordered_map<std::string, uint8_t> newWideLookup;
+
+    for (size_t i = 0; i < newSymbols.size(); ++i) {
+        const std::string& symbol = newSymbols[i];
+        uint8_t id = static_cast<uint8_t>(i);
+
+        if (symbol.size() == 1) {
+            unsigned char key = fold(static_cast<unsigned char>(symbol[0]));
+            if (newByteLookup[key] != NOT_FOUND) {
+                return false;
+            }
+            newByteLookup[key] = id;
+        } else if (!newWideLookup.insert(std::make_pair(fold(symbol), id)).second) {
+            return false;
+        }
+    }
+
+    symbols = newSymbols;
+    std::memcpy(byteLookup, newByteLookup, sizeof(byteLookup));
+    wideLookup.swap(newWideLookup);
+    return true;
+}
+
+uint8_t SymbolTable::find(const std::string& symbol) const {
+    if (symbol.size() == 1) {
+        return byteLookup[fold(static_cast<unsigned char>(symbol[0]))];
+    }
+
+    if (wideLookup.empty()) {
+        return NOT_FOUND;
+    }
+
+    auto it = wideLookup.find(caseInsensitive ? fold(symbol) : symbol);
+    return it != wideLookup.end() ? it->second : NOT_FOUND;
+}
+
+uint8_t SymbolTable::find(char symbol) const {
+    return byteLookup[fold(static_cast<unsigned char>(symbol))];
+}
+
+bool SymbolTable::contains(const std::string& symbol) const {
+    return find(symbol) != NOT_FOUND;
+}
+
+const std::string& SymbolTable::name(uint8_t id) const {
+    return symbols[id];
+}
+
+const std::vector<std::string>& SymbolTable::getSymbols() const {
+    return symbols;
+}
+
+size_t SymbolTable::size() const {
+    return symbols.size();
+}
+
+bool SymbolTable::isValidSymbolSet(const std::vector<std::string>& symbols) {
+    SymbolTable table;
+    return table.assign(symbols);
+}
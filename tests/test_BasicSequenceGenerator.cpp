@@ -0,0 +1,92 @@
+/**
+ * @file test_BasicSequenceGenerator.cpp
+ * @brief Testes unitários para o template BasicSequenceGenerator
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "BasicSequenceGenerator.h"
+
+typedef CharAlphabet<'R', 'G', 'B'> AlphabetRGB;
+
+// Tabela de símbolos resolvida em tempo de compilação
+static_assert(ClassicSequenceGenerator::ALPHABET_SIZE == 4, "alfabeto ABCD");
+static_assert(ClassicSequenceGenerator::findSymbolId('C') == 2, "busca constexpr");
+static_assert(ClassicSequenceGenerator::findSymbolId('Z') == SequenceGenerator::INVALID_SYMBOL, "símbolo inválido");
+static_assert(ClassicSequenceGenerator::symbolName(3) == 'D', "tabela constexpr");
+
+DOCTEST_TEST_CASE("BasicSequenceGenerator - Alfabeto fixo") {
+    ClassicSequenceGenerator generator(2, 10);
+    DOCTEST_CHECK_EQ(generator.getSequenceLength(), 2);
+    DOCTEST_CHECK_EQ(generator.getMaxSequenceLength(), 10);
+
+    while (generator.addRandomElement() != '\0') {
+    }
+    DOCTEST_CHECK(generator.isAtMaxLength());
+    DOCTEST_CHECK_EQ(generator.toString().size(), 10);
+    DOCTEST_CHECK_EQ(generator.getElementAt(10), '\0');
+    DOCTEST_CHECK_EQ(generator.getSymbolIdAt(10), SequenceGenerator::INVALID_SYMBOL);
+
+    DOCTEST_CHECK_THROWS(ClassicSequenceGenerator(5, 4));
+}
+
+DOCTEST_TEST_CASE("BasicSequenceGenerator - Mesmos elementos que SequenceGenerator") {
+    ClassicSequenceGenerator fixed(1, 200);
+    SequenceGenerator runtime({"A", "B", "C", "D"}, 1, 200);
+    fixed.setSeed(77, 3);
+    runtime.setSeed(77, 3);
+
+    BasicSequenceGenerator<AlphabetRGB> fixedRgb(1, 200);
+    SequenceGenerator runtimeRgb({"R", "G", "B"}, 1, 200);
+    fixedRgb.setSeed(77, 3);
+    runtimeRgb.setSeed(77, 3);
+
+    for (int i = 0; i < 150; ++i) {
+        fixed.addRandomElement();
+        runtime.addRandomElement();
+        fixedRgb.addRandomElement();
+        runtimeRgb.addRandomElement();
+    }
+
+    DOCTEST_CHECK(fixed.getSymbolIds() == runtime.getSymbolIds());
+    DOCTEST_CHECK(fixedRgb.getSymbolIds() == runtimeRgb.getSymbolIds());
+    DOCTEST_CHECK_EQ(fixed.toString(), runtime.toString(""));
+    DOCTEST_CHECK(fixed.toGenerator() == runtime);
+
+    fixed.reset();
+    runtime.reset();
+    DOCTEST_CHECK_EQ(fixed.getSessionId(), 4);
+    DOCTEST_CHECK(fixed.getSymbolIds() == runtime.getSymbolIds());
+}
+
+DOCTEST_TEST_CASE("BasicSequenceGenerator - Validação") {
+    ClassicSequenceGenerator generator(1, 100);
+    generator.setSeed(5);
+    for (int i = 0; i < 40; ++i) {
+        generator.addRandomElement();
+    }
+
+    std::string typed = generator.toString();
+    auto result = generator.validateUserSequence(typed);
+    DOCTEST_CHECK(result.first);
+    DOCTEST_CHECK_EQ(result.second, 40);
+
+    const size_t positions[] = {0, 7, 8, 23, 40};
+    for (size_t position : positions) {
+        std::string wrong = typed;
+        wrong[position] = wrong[position] == 'A' ? 'B' : 'A';
+        result = generator.validateUserSequence(wrong);
+        DOCTEST_CHECK(!result.first);
+        DOCTEST_CHECK_EQ(result.second, static_cast<int>(position));
+    }
+
+    result = generator.validateUserSequence(typed.substr(0, 5) + "X", 4);
+    DOCTEST_CHECK(result.first);
+    DOCTEST_CHECK_EQ(result.second, 4);
+
+    result = generator.validateUserSequence(typed + "A");
+    DOCTEST_CHECK(!result.first);
+    DOCTEST_CHECK_EQ(result.second, 41);
+}
@@ -0,0 +1,61 @@
+/**
+ * @file test_CounterRng.cpp
+ * @brief Testes unitários para a classe CounterRng
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "CounterRng.h"
+#include <vector>
+
+DOCTEST_TEST_CASE("CounterRng - Vetores de referência do Philox4x32-10") {
+    CounterRng::Block zero = CounterRng::philox({{0, 0, 0, 0}}, {{0, 0}});
+    DOCTEST_CHECK_EQ(zero[0], 0x6627e8d5u);
+    DOCTEST_CHECK_EQ(zero[1], 0xe169c58du);
+    DOCTEST_CHECK_EQ(zero[2], 0xbc57ac4cu);
+    DOCTEST_CHECK_EQ(zero[3], 0x9b00dbd8u);
+
+    CounterRng::Block pi = CounterRng::philox({{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}},
+                                              {{0xa4093822u, 0x299f31d0u}});
+    DOCTEST_CHECK_EQ(pi[0], 0xd16cfe09u);
+    DOCTEST_CHECK_EQ(pi[1], 0x94fdccebu);
+    DOCTEST_CHECK_EQ(pi[2], 0x5001e420u);
+    DOCTEST_CHECK_EQ(pi[3], 0x24126ea1u);
+}
+
+DOCTEST_TEST_CASE("CounterRng - Função pura de semente, sessão e índice") {
+    CounterRng a(42, 7);
+    CounterRng b(42, 7);
+    CounterRng otherSession(42, 8);
+
+    bool sessionDiffers = false;
+    for (uint64_t i = 0; i < 64; ++i) {
+        DOCTEST_CHECK_EQ(a.boundedAt(i, 4), b.boundedAt(i, 4));
+        if (a.blockAt(i) != otherSession.blockAt(i)) {
+            sessionDiffers = true;
+        }
+    }
+    DOCTEST_CHECK(sessionDiffers);
+
+    // Salto direto para um índice distante
+    DOCTEST_CHECK_EQ(a.boundedAt(1000000000ULL, 10), b.boundedAt(1000000000ULL, 10));
+}
+
+DOCTEST_TEST_CASE("CounterRng - Distribuição limitada") {
+    CounterRng rng(123, 0);
+    std::vector<int> counts(6, 0);
+    const int samples = 6000;
+
+    for (int i = 0; i < samples; ++i) {
+        uint32_t value = rng.boundedAt(static_cast<uint64_t>(i), 6);
+        DOCTEST_CHECK_LT(value, 6u);
+        counts[value]++;
+    }
+
+    for (int count : counts) {
+        DOCTEST_CHECK_GT(count, 800);
+        DOCTEST_CHECK_LT(count, 1200);
+    }
+}
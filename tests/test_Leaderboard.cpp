@@ -0,0 +1,197 @@
+/**
+ * @file test_Leaderboard.cpp
+ * @brief Testes unitários para a classe Leaderboard
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "Leaderboard.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Cria uma entrada identificada pelo nome
+ */
+ScoreEntry makeEntry(const std::string& name, int score, int level = 1) {
+    return ScoreEntry(name, score, level, "01/01/2025 10:00", 50.0, 1000, 0);
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("Leaderboard - Inserção e colocação") {
+    Leaderboard board(3);
+    DOCTEST_CHECK(board.empty());
+
+    DOCTEST_CHECK_EQ(board.insert(makeEntry("A", 100)), 1);
+    DOCTEST_CHECK_EQ(board.insert(makeEntry("B", 300)), 1);
+    DOCTEST_CHECK_EQ(board.insert(makeEntry("C", 200)), 2);
+    DOCTEST_CHECK(board.full());
+
+    // Empate: a entrada mais antiga fica à frente; o nível desempata
+    DOCTEST_CHECK(!board.qualifies(makeEntry("D", 100)));
+    DOCTEST_CHECK_EQ(board.insert(makeEntry("D", 100)), 0);
+    DOCTEST_CHECK_EQ(board.insert(makeEntry("E", 100, 2)), 3);
+    DOCTEST_CHECK_EQ(board.size(), 3);
+    DOCTEST_CHECK_EQ(board.back().playerName, "E");
+
+    DOCTEST_CHECK_EQ(board.insert(makeEntry("F", 300)), 2);
+    DOCTEST_CHECK_EQ(board.front().playerName, "B");
+    DOCTEST_CHECK_EQ(board[1].playerName, "F");
+    DOCTEST_CHECK_EQ(board.back().playerName, "C");
+
+    DOCTEST_CHECK_EQ(board.setCapacity(1), 2);
+    DOCTEST_CHECK_EQ(board.size(), 1);
+    DOCTEST_CHECK_EQ(board.front().playerName, "B");
+}
+
+DOCTEST_TEST_CASE("Leaderboard - Blocos com muitas entradas") {
+    const size_t capacity = 5 * Leaderboard::BLOCK_SIZE;
+    Leaderboard board(capacity);
+    std::vector<ScoreEntry> reference;
+
+    // Pontuações pseudoaleatórias com muitos empates
+    unsigned state = 12345;
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        state = state * 1103515245u + 12345u;
+        ScoreEntry entry = makeEntry("P" + std::to_string(i), static_cast<int>((state >> 16) % 1000));
+
+        auto position = std::upper_bound(reference.begin(), reference.end(), entry,
+                                         [](const ScoreEntry& a, const ScoreEntry& b) { return a > b; });
+        size_t expected = static_cast<size_t>(position - reference.begin()) + 1;
+        if (expected > capacity) {
+            expected = 0;
+        } else {
+            reference.insert(position, entry);
+            if (reference.size() > capacity) {
+                reference.pop_back();
+            }
+        }
+        DOCTEST_CHECK_EQ(board.insert(entry), expected);
+    }
+
+    DOCTEST_CHECK_EQ(board.size(), capacity);
+    DOCTEST_CHECK_GT(board.getBlockCount(), 1);
+
+    std::vector<ScoreEntry> contents = board.toVector();
+    bool same = contents.size() == reference.size();
+    for (size_t i = 0; same && i < contents.size(); ++i) {
+        same = contents[i].playerName == reference[i].playerName;
+    }
+    DOCTEST_CHECK(same);
+    DOCTEST_CHECK_EQ(board[capacity - 1].playerName, reference.back().playerName);
+
+    // Remoções mantêm a ordem e a contagem
+    for (size_t i = 0; i < Leaderboard::BLOCK_SIZE; ++i) {
+        board.erase(i);
+        reference.erase(reference.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+    size_t removed = board.removeIf([](const ScoreEntry& entry) { return entry.score % 2 == 0; });
+    size_t expectedRemoved = static_cast<size_t>(std::count_if(reference.begin(), reference.end(),
+        [](const ScoreEntry& entry) { return entry.score % 2 == 0; }));
+    DOCTEST_CHECK_EQ(removed, expectedRemoved);
+    DOCTEST_CHECK_EQ(board.size(), reference.size() - expectedRemoved);
+
+    size_t visited = 0;
+    bool ordered = true;
+    const ScoreEntry* previous = nullptr;
+    for (const auto& entry : board) {
+        ordered = ordered && entry.score % 2 != 0 && (previous == nullptr || !(entry > *previous));
+        previous = &entry;
+        visited++;
+    }
+    DOCTEST_CHECK(ordered);
+    DOCTEST_CHECK_EQ(visited, board.size());
+}
+
+DOCTEST_TEST_CASE("Leaderboard - Carga em lote") {
+    Leaderboard board(4);
+    board.assign({makeEntry("A", 10), makeEntry("B", 50), makeEntry("C", 10),
+                  makeEntry("D", 30), makeEntry("E", 10)});
+
+    // Ordenação estável e truncada à capacidade
+    DOCTEST_CHECK_EQ(board.size(), 4);
+    std::vector<ScoreEntry> contents = board.toVector(3);
+    DOCTEST_CHECK_EQ(contents.size(), 3);
+    DOCTEST_CHECK_EQ(contents[0].playerName, "B");
+    DOCTEST_CHECK_EQ(contents[2].playerName, "A");
+    DOCTEST_CHECK_EQ(board.back().playerName, "C");
+
+    board.clear();
+    DOCTEST_CHECK(board.empty());
+    DOCTEST_CHECK(board.begin() == board.end());
+    DOCTEST_CHECK_EQ(board.insert(makeEntry("F", 1)), 1);
+}
+
+DOCTEST_TEST_CASE("Leaderboard - Índice por jogador") {
+    Leaderboard board(4);
+    board.insert(makeEntry("Ana", 100));
+    board.insert(makeEntry("ANA", 300));
+    board.insert(makeEntry("Bia", 200));
+    board.insert(makeEntry("ana", 50));
+    DOCTEST_CHECK_EQ(board.getPlayerCount(), 2);
+
+    std::vector<ScoreEntry> ana = board.getPlayerEntries("aNa");
+    DOCTEST_CHECK_EQ(ana.size(), 3);
+    DOCTEST_CHECK_EQ(ana.front().score, 300);
+    DOCTEST_CHECK_EQ(ana.back().score, 50);
+    DOCTEST_CHECK_EQ(board.findPlayerBest("ana")->playerName, "ANA");
+    DOCTEST_CHECK(board.findPlayerBest("Caio") == nullptr);
+    DOCTEST_CHECK(board.getPlayerEntries("Caio").empty());
+
+    // O descarte por capacidade sai do fim da lista do jogador
+    board.insert(makeEntry("Caio", 150));
+    DOCTEST_CHECK_EQ(board.getPlayerEntryCount("ana"), 2);
+    DOCTEST_CHECK_EQ(board.getPlayerEntries("ana").back().score, 100);
+    DOCTEST_CHECK_EQ(board.getPlayerCount(), 3);
+
+    // Remoção por colocação e por jogador
+    board.erase(1); // Bia, 200
+    DOCTEST_CHECK_EQ(board.getPlayerEntryCount("bia"), 0);
+    DOCTEST_CHECK_EQ(board.removePlayer("ANA"), 2);
+    DOCTEST_CHECK_EQ(board.size(), 1);
+    DOCTEST_CHECK_EQ(board.front().playerName, "Caio");
+    DOCTEST_CHECK_EQ(board.getIndex().size(), 1);
+    DOCTEST_CHECK_EQ(board.removePlayer("ana"), 0);
+
+    board.assign({makeEntry("Davi", 10), makeEntry("davi", 20)});
+    DOCTEST_CHECK_EQ(board.getPlayerCount(), 1);
+    DOCTEST_CHECK_EQ(board.findPlayerBest("DAVI")->score, 20);
+    board.clear();
+    DOCTEST_CHECK_EQ(board.getPlayerCount(), 0);
+}
+
+DOCTEST_TEST_CASE("Leaderboard - Um único jogador com capacidade grande") {
+    // Cenário típico de uma máquina: quase todas as entradas são do mesmo jogador
+    const size_t inserts = 100000;
+    Leaderboard board(1000000);
+
+    unsigned state = 24680u;
+    for (size_t i = 0; i < inserts; ++i) {
+        state = state * 1103515245u + 12345u;
+        board.insert(makeEntry(i % 50 == 0 ? "Outro" : "Ana", static_cast<int>((state >> 16) % 5000)));
+    }
+    DOCTEST_CHECK_EQ(board.size(), inserts);
+    DOCTEST_CHECK_EQ(board.getPlayerCount(), 2);
+    DOCTEST_CHECK_EQ(board.getPlayerEntryCount("ana") + board.getPlayerEntryCount("OUTRO"), inserts);
+
+    // A lista do jogador segue a ordem do ranking
+    std::vector<ScoreEntry> ana = board.getPlayerEntries("Ana");
+    DOCTEST_CHECK_EQ(ana.size(), board.getPlayerEntryCount("ana"));
+    bool ordered = true;
+    for (size_t i = 1; i < ana.size(); ++i) {
+        ordered = ordered && !(ana[i] > ana[i - 1]);
+    }
+    DOCTEST_CHECK(ordered);
+    DOCTEST_CHECK_EQ(board.findPlayerBest("ana")->score, ana.front().score);
+
+    // Descartes por capacidade mantêm o índice
+    DOCTEST_CHECK_EQ(board.setCapacity(1000), inserts - 1000);
+    DOCTEST_CHECK_EQ(board.getPlayerEntryCount("ana") + board.getPlayerEntryCount("outro"), 1000);
+    DOCTEST_CHECK_EQ(board.removePlayer("outro") + board.getPlayerEntryCount("ana"), 1000);
+    DOCTEST_CHECK_EQ(board.size(), board.getPlayerEntryCount("ana"));
+}
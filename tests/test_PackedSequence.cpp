@@ -0,0 +1,173 @@
+/**
+ * @file test_PackedSequence.cpp
+ * @brief Testes unitários para a classe PackedSequence
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "PackedSequence.h"
+#include "SequenceGenerator.h"
+#include <utility>
+
+DOCTEST_TEST_CASE("PackedSequence - Largura por alfabeto") {
+    DOCTEST_CHECK_EQ(PackedSequence::bitsForAlphabet(2), 2);
+    DOCTEST_CHECK_EQ(PackedSequence::bitsForAlphabet(4), 2);
+    DOCTEST_CHECK_EQ(PackedSequence::bitsForAlphabet(5), 4);
+    DOCTEST_CHECK_EQ(PackedSequence::bitsForAlphabet(16), 4);
+    DOCTEST_CHECK_EQ(PackedSequence::bitsForAlphabet(17), 8);
+    DOCTEST_CHECK_EQ(PackedSequence(3).getBitsPerSymbol(), 8);
+}
+
+DOCTEST_TEST_CASE("PackedSequence - Armazenamento e leitura") {
+    const unsigned widths[] = {2, 4, 8};
+    for (unsigned bits : widths) {
+        PackedSequence sequence(bits);
+        uint8_t limit = static_cast<uint8_t>((1u << bits) - 1);
+        for (size_t i = 0; i < 1000; ++i) {
+            sequence.push_back(static_cast<uint8_t>((i * 7) % (limit + 1u)));
+        }
+
+        DOCTEST_CHECK_EQ(sequence.size(), 1000);
+        DOCTEST_CHECK_EQ(sequence.get(0), 0);
+        DOCTEST_CHECK_EQ(sequence.get(999), static_cast<uint8_t>((999 * 7) % (limit + 1u)));
+        DOCTEST_CHECK_EQ(sequence.getStorageBytes(), ((1000 * bits + 63) / 64) * 8);
+
+        auto ids = sequence.toIds();
+        PackedSequence copy(bits);
+        copy.assign(ids);
+        DOCTEST_CHECK(copy == sequence);
+    }
+}
+
+DOCTEST_TEST_CASE("PackedSequence - Primeira divergência") {
+    PackedSequence reference(2);
+    for (size_t i = 0; i < 5000; ++i) {
+        reference.push_back(static_cast<uint8_t>(i % 4));
+    }
+
+    DOCTEST_SUBCASE("Sequências iguais") {
+        PackedSequence same = reference;
+        DOCTEST_CHECK_EQ(PackedSequence::firstMismatch(reference, same, 5000), 5000);
+    }
+
+    DOCTEST_SUBCASE("Divergências em várias posições") {
+        const size_t positions[] = {0, 31, 32, 63, 200, 511, 4097, 4999};
+        for (size_t position : positions) {
+            auto ids = reference.toIds();
+            ids[position] = static_cast<uint8_t>((ids[position] + 1) % 4);
+            PackedSequence changed(2);
+            changed.assign(ids);
+            DOCTEST_CHECK_EQ(PackedSequence::firstMismatch(reference, changed, 5000), position);
+            DOCTEST_CHECK_EQ(PackedSequence::firstMismatch(reference, changed, position), position);
+        }
+    }
+
+    DOCTEST_SUBCASE("Larguras diferentes") {
+        PackedSequence wide = reference;
+        wide.repack(8);
+        DOCTEST_CHECK_EQ(wide.getBitsPerSymbol(), 8);
+        DOCTEST_CHECK(wide == reference);
+    }
+}
+
+DOCTEST_TEST_CASE("PackedSequence - Blocos crescentes") {
+    PackedSequence sequence(4);
+    const size_t count = 300000;
+    for (size_t i = 0; i < count; ++i) {
+        sequence.push_back(static_cast<uint8_t>((i * 5 + i / 16) % 16));
+    }
+
+    DOCTEST_CHECK_EQ(sequence.size(), count);
+    DOCTEST_CHECK_EQ(sequence.get(count - 1), static_cast<uint8_t>(((count - 1) * 5 + (count - 1) / 16) % 16));
+    DOCTEST_CHECK_EQ(sequence.get(12345), static_cast<uint8_t>((12345 * 5 + 12345 / 16) % 16));
+    DOCTEST_CHECK_LE(sequence.getAllocatedBytes(), 2 * sequence.getStorageBytes());
+
+    DOCTEST_SUBCASE("Cópia e movimentação") {
+        PackedSequence copy(sequence);
+        DOCTEST_CHECK(copy == sequence);
+
+        PackedSequence moved(std::move(copy));
+        DOCTEST_CHECK(moved == sequence);
+        DOCTEST_CHECK(copy.empty());
+
+        copy = moved;
+        DOCTEST_CHECK(copy == sequence);
+
+        // Atribuir uma sequência menor reaproveita os blocos existentes
+        size_t allocated = copy.getAllocatedBytes();
+        PackedSequence small(2);
+        small.assign({1, 2, 3});
+        copy = small;
+        DOCTEST_CHECK(copy == small);
+        DOCTEST_CHECK_EQ(copy.getBitsPerSymbol(), 2);
+        DOCTEST_CHECK_EQ(copy.getAllocatedBytes(), allocated);
+    }
+
+    DOCTEST_SUBCASE("Divergência em blocos distantes") {
+        // Limites de bloco: 8, 24, 56, ... palavras (16 elementos por palavra)
+        const size_t positions[] = {127, 128, 383, 384, 895, 896, 262143, count - 1};
+        for (size_t position : positions) {
+            PackedSequence changed(sequence);
+            auto ids = changed.toIds();
+            ids[position] = static_cast<uint8_t>((ids[position] + 1) % 16);
+            changed.assign(ids);
+            DOCTEST_CHECK_EQ(PackedSequence::firstMismatch(sequence, changed, count), position);
+        }
+    }
+
+    DOCTEST_SUBCASE("Limpar reaproveita os blocos") {
+        size_t allocated = sequence.getAllocatedBytes();
+        sequence.clear();
+        sequence.push_back(3);
+        DOCTEST_CHECK_EQ(sequence.getAllocatedBytes(), allocated);
+        DOCTEST_CHECK_EQ(sequence.get(0), 3);
+        DOCTEST_CHECK_EQ(sequence.getStorageBytes(), 8);
+    }
+}
+
+DOCTEST_TEST_CASE("SequenceGenerator - Armazenamento compactado") {
+    SequenceGenerator generator({"A", "B", "C", "D"}, 1);
+    generator.setCustomSequence({"D", "C", "B", "A", "D"});
+    generator.setPackedStorage(true);
+
+    DOCTEST_CHECK(generator.isPackedStorage());
+    DOCTEST_CHECK_EQ(generator.getPackedSequence().getBitsPerSymbol(), 2);
+    DOCTEST_CHECK_EQ(generator.toString(""), "DCBAD");
+
+    PackedSequence replay(2);
+    replay.assign({3, 2, 1, 0, 3});
+    auto result = generator.validateUserSequence(replay);
+    DOCTEST_CHECK(result.first);
+    DOCTEST_CHECK_EQ(result.second, 4);
+
+    replay.assign({3, 2, 2, 0, 3});
+    result = generator.validateUserSequence(replay);
+    DOCTEST_CHECK(!result.first);
+    DOCTEST_CHECK_EQ(result.second, 2);
+
+    generator.setPackedStorage(false);
+    DOCTEST_CHECK_EQ(generator.getPackedSequence().getBitsPerSymbol(), 8);
+    DOCTEST_CHECK_EQ(generator.toString(""), "DCBAD");
+}
+
+DOCTEST_TEST_CASE("SequenceGenerator - Comprimento máximo configurável") {
+    SequenceGenerator generator({"A", "B", "C", "D"}, 1, 200000);
+    generator.setPackedStorage(true);
+    DOCTEST_CHECK_EQ(generator.getMaxSequenceLength(), 200000);
+
+    while (!generator.addRandomElement().empty()) {
+    }
+
+    DOCTEST_CHECK(generator.isAtMaxLength());
+    DOCTEST_CHECK_EQ(generator.getSequenceLength(), 200000);
+    DOCTEST_CHECK_EQ(generator.getSymbolIdAt(150000), generator.symbolIdForIndex(150000));
+    DOCTEST_CHECK_LE(generator.getPackedSequence().getAllocatedBytes(), 2 * 200000 / 4);
+
+    DOCTEST_CHECK(!generator.setMaxSequenceLength(1000));
+    DOCTEST_CHECK(generator.setMaxSequenceLength(300000));
+    DOCTEST_CHECK(!generator.isAtMaxLength());
+
+    DOCTEST_CHECK_THROWS(SequenceGenerator({"A", "B"}, 5, 4));
+}
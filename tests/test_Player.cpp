@@ -10,6 +10,9 @@
 #include "Player.h"
 #include <thread>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
 
 DOCTEST_TEST_CASE("Player - Construtor básico") {
     DOCTEST_SUBCASE("Construtor com parâmetros padrão") {
@@ -373,4 +376,292 @@ DOCTEST_TEST_CASE("Player - Reset e construtor de cópia") {
         DOCTEST_CHECK_EQ(assigned.getName(), original.getName());
         DOCTEST_CHECK_EQ(assigned.getScore(), original.getScore());
     }
-}
\ No newline at end of file
+}
+DOCTEST_TEST_CASE("Player - Histórico tipado de eventos") {
+    Player player("Historiador");
+    player.startGame();
+    player.startInputSequence();
+    player.addInput("A");
+    player.addInput("B");
+    player.addInput("A");
+    player.recordSuccessfulSequence(3);
+    player.advanceLevel(7);
+    player.loseLife("Sequencia incorreta");
+    player.endGame();
+
+    const PlayerHistory& history = player.getHistory();
+    DOCTEST_CHECK_EQ(history.size(), 10);
+    DOCTEST_CHECK(history.getEvents()[0].action == PlayerAction::GAME_STARTED);
+    DOCTEST_CHECK(history.getEvents()[1].action == PlayerAction::INPUT_ADDED);
+
+    // Símbolos repetidos compartilham o mesmo texto internado
+    DOCTEST_CHECK_EQ(history.getEvents()[1].textId, history.getEvents()[3].textId);
+    DOCTEST_CHECK(history.getEvents()[1].textId != history.getEvents()[2].textId);
+
+    DOCTEST_SUBCASE("Forma de mapa construída sob demanda") {
+        auto maps = player.getGameHistory();
+        DOCTEST_CHECK_EQ(maps.size(), history.size());
+        DOCTEST_CHECK_EQ(maps[0]["action"], "game_started");
+        DOCTEST_CHECK_EQ(maps[0]["playerName"], "Historiador");
+        DOCTEST_CHECK_EQ(maps[3]["input"], "A");
+        DOCTEST_CHECK_EQ(maps[3]["sequencePosition"], "2");
+        DOCTEST_CHECK_EQ(maps[4]["action"], "score_added");
+        DOCTEST_CHECK_EQ(maps[4]["reason"], "Sequence completed (Length: 3)");
+        DOCTEST_CHECK_EQ(maps[4]["points"], "30");
+        DOCTEST_CHECK_EQ(maps[5]["action"], "sequence_completed");
+        DOCTEST_CHECK_EQ(maps[5]["pointsEarned"], "30");
+        DOCTEST_CHECK_EQ(maps[6]["reason"], "Level 1 completion bonus");
+        DOCTEST_CHECK_EQ(maps[6]["totalScore"], "37");
+        DOCTEST_CHECK_EQ(maps[7]["level"], "2");
+        DOCTEST_CHECK_EQ(maps[7]["bonusPoints"], "7");
+        DOCTEST_CHECK_EQ(maps[8]["reason"], "Sequencia incorreta");
+        DOCTEST_CHECK_EQ(maps[8]["livesRemaining"], "2");
+        DOCTEST_CHECK_EQ(maps[9]["finalScore"], "37");
+        DOCTEST_CHECK_EQ(maps[9].size(), 4);
+    }
+
+    DOCTEST_SUBCASE("Novo jogo limpa o histórico") {
+        player.startGame();
+        DOCTEST_CHECK_EQ(player.getHistory().size(), 1);
+    }
+}
+
+DOCTEST_TEST_CASE("Player - Histórico limitado e spill em arquivo") {
+    const char* spillPath = "test_history_spill.bin";
+    std::remove(spillPath);
+
+    Player player("Maratonista");
+    player.setHistoryCapacity(8);
+    DOCTEST_CHECK(player.enableHistorySpill(spillPath));
+
+    player.startGame();
+    player.startInputSequence();
+    for (int i = 0; i < 100; ++i) {
+        player.addInput(i % 2 == 0 ? "A" : "B");
+    }
+    player.loseLife("Tempo esgotado");
+    player.endGame();
+
+    const PlayerHistory& history = player.getHistory();
+    DOCTEST_CHECK_EQ(history.size(), 8);
+    DOCTEST_CHECK_EQ(history.getTotalRecorded(), 103);
+    DOCTEST_CHECK(history.at(7).action == PlayerAction::GAME_ENDED);
+    DOCTEST_CHECK(history.at(6).action == PlayerAction::LIFE_LOST);
+    DOCTEST_CHECK_EQ(history.at(0).values[0], 94);
+
+    auto recent = player.getGameHistory();
+    DOCTEST_CHECK_EQ(recent.size(), 8);
+    DOCTEST_CHECK_EQ(recent[6]["reason"], "Tempo esgotado");
+
+    DOCTEST_SUBCASE("Arquivo contém o registro completo") {
+        PlayerHistory full;
+        DOCTEST_CHECK(PlayerHistory::loadSpillFile(spillPath, full));
+        DOCTEST_CHECK_EQ(full.size(), 103);
+        auto maps = full.toMaps();
+        DOCTEST_CHECK_EQ(maps[0]["playerName"], "Maratonista");
+        DOCTEST_CHECK_EQ(maps[1]["input"], "A");
+        DOCTEST_CHECK_EQ(maps[2]["input"], "B");
+        DOCTEST_CHECK_EQ(maps[101]["reason"], "Tempo esgotado");
+        DOCTEST_CHECK_EQ(full.at(102).timestamp, history.at(7).timestamp);
+    }
+
+    DOCTEST_SUBCASE("Cópias não gravam no arquivo") {
+        Player copy(player);
+        copy.startGame();
+        copy.endGame();
+        DOCTEST_CHECK(!copy.getHistory().isSpilling());
+        DOCTEST_CHECK_EQ(copy.getHistory().getCapacity(), 8);
+
+        PlayerHistory full;
+        PlayerHistory::loadSpillFile(spillPath, full);
+        DOCTEST_CHECK_EQ(full.size(), 103);
+    }
+
+    DOCTEST_SUBCASE("Reduzir a capacidade mantém os mais recentes") {
+        player.setHistoryCapacity(2);
+        DOCTEST_CHECK_EQ(player.getHistory().size(), 2);
+        DOCTEST_CHECK(player.getHistory().at(1).action == PlayerAction::GAME_ENDED);
+    }
+
+    player.disableHistorySpill();
+    std::remove(spillPath);
+}
+
+DOCTEST_TEST_CASE("Player - Estatísticas de tempo de reação") {
+    Player player("Reflexo");
+    player.startGame();
+    player.startInputSequence();
+    for (int i = 0; i < 4; ++i) {
+        player.addInput("A");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    const ReactionTimeStats& reaction = player.getReactionStats();
+    DOCTEST_CHECK_EQ(reaction.getCount(), 3);
+    DOCTEST_CHECK_GE(reaction.getMin(), 1.0);
+    DOCTEST_CHECK_GE(reaction.getPercentile(99.0), reaction.getPercentile(50.0));
+
+    auto stats = player.getStatistics();
+    DOCTEST_CHECK(stats.count("reactionTimeP90") == 1);
+
+    player.startGame();
+    DOCTEST_CHECK_EQ(player.getReactionStats().getCount(), 0);
+}
+
+DOCTEST_TEST_CASE("Player - Estatísticas tipadas") {
+    Player player("Tipado", 4);
+    player.startGame();
+    player.recordSuccessfulSequence(3);
+    player.recordSuccessfulSequence(4);
+    player.recordSuccessfulSequence(5);
+    player.loseLife("Erro");
+
+    PlayerStats stats = player.getStats();
+    DOCTEST_CHECK_EQ(stats.score, player.getScore());
+    DOCTEST_CHECK_EQ(stats.lives, 3);
+    DOCTEST_CHECK_EQ(stats.maxLives, 4);
+    DOCTEST_CHECK_EQ(stats.totalCorrectSequences, 3);
+    DOCTEST_CHECK_EQ(stats.totalWrongAttempts, 1);
+    DOCTEST_CHECK_EQ(stats.currentStreak, 0);
+    DOCTEST_CHECK_EQ(stats.accuracy, 75.0);
+    DOCTEST_CHECK(stats.isGameActive);
+    DOCTEST_CHECK(stats.isAlive);
+
+    // O mapa de compatibilidade é derivado do retrato tipado
+    auto map = player.getStatistics();
+    DOCTEST_CHECK_EQ(map["accuracy"], "75.0");
+    DOCTEST_CHECK_EQ(map["score"], std::to_string(stats.score));
+    DOCTEST_CHECK_EQ(map["totalWrongAttempts"], "1");
+    DOCTEST_CHECK_EQ(Player::formatAccuracy(0.0), "0.0");
+
+    player.endGame();
+    DOCTEST_CHECK(!player.getStats().isGameActive);
+}
+
+DOCTEST_TEST_CASE("Player - Movimentação e estado quente") {
+    DOCTEST_CHECK_LE(sizeof(PlayerHotState), 64);
+    DOCTEST_CHECK(!std::is_polymorphic<Player>::value);
+
+    Player original("Movel", 5);
+    original.startGame();
+    original.recordSuccessfulSequence(4);
+    original.addInput("A");
+
+    Player moved(std::move(original));
+    DOCTEST_CHECK_EQ(moved.getName(), "Movel");
+    DOCTEST_CHECK_EQ(moved.getHotState().currentStreak, 1);
+    DOCTEST_CHECK_EQ(moved.getHotState().maxLives, 5);
+    DOCTEST_CHECK_EQ(moved.getCurrentInput().size(), 1);
+
+    // O objeto movido pode receber uma nova atribuição
+    original = Player("Novo");
+    DOCTEST_CHECK_EQ(original.getName(), "Novo");
+    DOCTEST_CHECK_EQ(original.getScore(), 0);
+
+    std::vector<Player> lobby;
+    for (int i = 0; i < 100; ++i) {
+        lobby.push_back(Player("P" + std::to_string(i)));
+        lobby.back().addScore(i);
+    }
+    int total = 0;
+    for (const auto& player : lobby) {
+        total += player.getHotState().score;
+    }
+    DOCTEST_CHECK_EQ(total, 4950);
+    DOCTEST_CHECK_EQ(lobby[42].getName(), "P42");
+
+    Player copy(moved);
+    copy.addInput("B");
+    DOCTEST_CHECK_EQ(moved.getCurrentInput().size(), 1);
+    DOCTEST_CHECK_EQ(copy.getCurrentInput().size(), 2);
+}
+
+DOCTEST_TEST_CASE("Player - Perfil binário") {
+    Player player("Perfil", 4);
+    player.startGame();
+    player.startInputSequence();
+    player.addInput("A");
+    player.recordSuccessfulSequence(3);
+    player.recordSuccessfulSequence(4);
+    player.loseLife("Teste");
+    player.endGame();
+
+    PlayerProfile profile = player.toProfile();
+    DOCTEST_CHECK(Player::isValidProfile(profile));
+    DOCTEST_CHECK_EQ(profile.size, sizeof(PlayerProfile));
+    DOCTEST_CHECK_EQ(profile.reserved, 0u);
+
+    // O restante do campo do nome é zerado, então o checksum é reprodutível
+    bool nameTailZero = true;
+    for (size_t i = std::strlen("Perfil"); i < PlayerProfile::NAME_SIZE; ++i) {
+        nameTailZero = nameTailZero && profile.name[i] == '\0';
+    }
+    DOCTEST_CHECK(nameTailZero);
+
+    Player loaded;
+    DOCTEST_CHECK(loaded.fromProfile(profile));
+    PlayerStats expected = player.getStats();
+    PlayerStats actual = loaded.getStats();
+    DOCTEST_CHECK_EQ(loaded.getName(), "Perfil");
+    DOCTEST_CHECK_EQ(actual.score, expected.score);
+    DOCTEST_CHECK_EQ(actual.lives, 3);
+    DOCTEST_CHECK_EQ(actual.maxLives, 4);
+    DOCTEST_CHECK_EQ(actual.bestStreak, expected.bestStreak);
+    DOCTEST_CHECK_EQ(actual.totalWrongAttempts, 1);
+    DOCTEST_CHECK_EQ(loaded.getReactionStats().getCount(), player.getReactionStats().getCount());
+    DOCTEST_CHECK_EQ(actual.reactionTimeP90, expected.reactionTimeP90);
+    DOCTEST_CHECK(!actual.isGameActive);
+
+    DOCTEST_SUBCASE("Arquivo com uma escrita e uma leitura") {
+        const std::string filename = "test_profile.bin";
+        DOCTEST_CHECK(player.saveProfile(filename));
+        Player fromFile;
+        DOCTEST_CHECK(fromFile.loadProfile(filename));
+        DOCTEST_CHECK_EQ(fromFile.getScore(), player.getScore());
+        std::remove(filename.c_str());
+        DOCTEST_CHECK(!fromFile.loadProfile(filename));
+    }
+
+    DOCTEST_SUBCASE("Perfil corrompido é rejeitado sem alterar o jogador") {
+        PlayerProfile corrupted = profile;
+        corrupted.score += 1;
+        Player untouched("Intacto");
+        DOCTEST_CHECK(!Player::isValidProfile(corrupted));
+        DOCTEST_CHECK(!untouched.fromProfile(corrupted));
+        DOCTEST_CHECK_EQ(untouched.getName(), "Intacto");
+        DOCTEST_CHECK_EQ(untouched.getScore(), 0);
+    }
+
+    DOCTEST_SUBCASE("Mapa como adaptador") {
+        auto saveData = player.toSaveData();
+        Player restored;
+        DOCTEST_CHECK(restored.fromSaveData(saveData));
+        DOCTEST_CHECK_EQ(restored.getScore(), player.getScore());
+        DOCTEST_CHECK_EQ(restored.getStats().totalWrongAttempts, 1);
+        DOCTEST_CHECK(!restored.fromSaveData({{"level", "0"}}));
+    }
+}
+
+DOCTEST_TEST_CASE("Player - Dados salvos aplicados durante o jogo") {
+    Player player("Durante", 3);
+    player.startGame();
+    player.recordSuccessfulSequence(3);
+    player.startInputSequence();
+    player.addInput("A");
+    player.addInput("B");
+    int score = player.getScore();
+
+    DOCTEST_CHECK(player.fromSaveData({{"name", "Renomeado"}, {"bestStreak", "9"}}));
+    DOCTEST_CHECK_EQ(player.getName(), "Renomeado");
+    DOCTEST_CHECK_EQ(player.getStats().bestStreak, 9);
+
+    // O jogo continua e a entrada pendente não é descartada
+    DOCTEST_CHECK(player.getStats().isGameActive);
+    DOCTEST_CHECK_EQ(player.getCurrentInput().size(), 2);
+    DOCTEST_CHECK_EQ(player.getScore(), score);
+
+    // Dados inválidos não alteram nada
+    DOCTEST_CHECK(!player.fromSaveData({{"name", "Outro"}, {"lives", "-1"}}));
+    DOCTEST_CHECK_EQ(player.getName(), "Renomeado");
+    DOCTEST_CHECK(player.getStats().isGameActive);
+}
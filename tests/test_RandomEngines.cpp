@@ -0,0 +1,115 @@
+/**
+ * @file test_RandomEngines.cpp
+ * @brief Testes unitários para os motores de RandomEngines.h
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "RandomEngines.h"
+#include "BasicSequenceGenerator.h"
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Verifica uniformidade aproximada de boundedRandom para um motor
+ */
+template <typename Engine>
+bool looksUniform(uint32_t range, int samples) {
+    Engine engine;
+    engine.seed(2025, 1);
+    std::vector<int> counts(range, 0);
+    for (int i = 0; i < samples; ++i) {
+        uint32_t value = boundedRandom(engine, range);
+        if (value >= range) {
+            return false;
+        }
+        counts[value]++;
+    }
+    int expected = samples / static_cast<int>(range);
+    for (int count : counts) {
+        if (count < expected * 8 / 10 || count > expected * 12 / 10) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("RandomEngines - Vetores de referência") {
+    SplitMix64 splitmix(0);
+    DOCTEST_CHECK_EQ(splitmix.next64(), 0xe220a8397b1dcdafULL);
+    DOCTEST_CHECK_EQ(splitmix.next64(), 0x6e789e6aa1b965f4ULL);
+
+    // pcg32_srandom_r(42, 54) do pcg32-demo
+    Pcg32 pcg(42, 54);
+    DOCTEST_CHECK_EQ(pcg.next32(), 0xa15c02b7u);
+    DOCTEST_CHECK_EQ(pcg.next32(), 0x7b47f409u);
+    DOCTEST_CHECK_EQ(pcg.next32(), 0xba1d3330u);
+
+    // O fluxo sequencial do Philox percorre as palavras dos blocos em ordem
+    PhiloxEngine philox(9, 3);
+    CounterRng::Block first = CounterRng(9, 3).blockAt(0);
+    for (uint32_t word : first) {
+        DOCTEST_CHECK_EQ(philox.next32(), word);
+    }
+}
+
+DOCTEST_TEST_CASE("RandomEngines - Semente e fluxos reproduzíveis") {
+    Xoshiro256StarStar a, b, otherStream;
+    a.seed(7, 1);
+    b.seed(7, 1);
+    otherStream.seed(7, 2);
+
+    bool differs = false;
+    for (int i = 0; i < 16; ++i) {
+        uint64_t value = a.next64();
+        DOCTEST_CHECK_EQ(value, b.next64());
+        differs = differs || value != otherStream.next64();
+    }
+    DOCTEST_CHECK(differs);
+}
+
+DOCTEST_TEST_CASE("RandomEngines - Redução de Lemire") {
+    DOCTEST_CHECK(looksUniform<SplitMix64>(6, 60000));
+    DOCTEST_CHECK(looksUniform<Xoshiro256StarStar>(7, 70000));
+    DOCTEST_CHECK(looksUniform<Pcg32>(3, 30000));
+    DOCTEST_CHECK(looksUniform<PhiloxEngine>(10, 100000));
+
+    Pcg32 engine(1, 1);
+    for (int i = 0; i < 100; ++i) {
+        DOCTEST_CHECK_EQ(boundedRandom(engine, 1), 0u);
+    }
+}
+
+DOCTEST_TEST_CASE("RandomEngines - Gerador especializado com motor sequencial") {
+    typedef BasicSequenceGenerator<AlphabetABCD, Pcg32> PcgGenerator;
+    typedef BasicSequenceGenerator<CharAlphabet<'X', 'Y', 'Z'>, Xoshiro256StarStar> XoshiroGenerator;
+
+    PcgGenerator first(1, 100);
+    PcgGenerator second(1, 100);
+    first.setSeed(99, 5);
+    second.setSeed(99, 5);
+    for (int i = 0; i < 60; ++i) {
+        DOCTEST_CHECK_EQ(first.addRandomElement(), second.addRandomElement());
+    }
+
+    // Reiniciar a mesma sessão reproduz a sequência; reset avança a sessão
+    std::string played = first.toString();
+    first.setSeed(99, 5);
+    while (first.getSequenceLength() < 61) {
+        first.addRandomElement();
+    }
+    DOCTEST_CHECK_EQ(first.toString(), played);
+    first.reset();
+    DOCTEST_CHECK_EQ(first.getSessionId(), 6);
+
+    XoshiroGenerator xyz(3, 50);
+    DOCTEST_CHECK_EQ(xyz.getSequenceLength(), 3);
+    for (char symbol : xyz.toString()) {
+        DOCTEST_CHECK(XoshiroGenerator::findSymbolId(symbol) != SequenceGenerator::INVALID_SYMBOL);
+    }
+}
@@ -0,0 +1,90 @@
+/**
+ * @file test_ReactionTimeStats.cpp
+ * @brief Testes unitários para a classe ReactionTimeStats
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "ReactionTimeStats.h"
+#include <cmath>
+
+DOCTEST_TEST_CASE("ReactionTimeStats - Acumulador vazio") {
+    ReactionTimeStats stats;
+    DOCTEST_CHECK_EQ(stats.getCount(), 0);
+    DOCTEST_CHECK_EQ(stats.getMean(), 0.0);
+    DOCTEST_CHECK_EQ(stats.getVariance(), 0.0);
+    DOCTEST_CHECK_EQ(stats.getPercentile(50.0), 0.0);
+    DOCTEST_CHECK_EQ(stats.getMax(), 0.0);
+}
+
+DOCTEST_TEST_CASE("ReactionTimeStats - Média e variância de Welford") {
+    ReactionTimeStats stats;
+    const double samples[] = {200.0, 400.0, 400.0, 400.0, 500.0, 500.0, 700.0, 900.0};
+    for (double sample : samples) {
+        stats.record(sample);
+    }
+
+    DOCTEST_CHECK_EQ(stats.getCount(), 8);
+    DOCTEST_CHECK(std::fabs(stats.getMean() - 500.0) < 1e-9);
+    DOCTEST_CHECK(std::fabs(stats.getVariance() - 320000.0 / 7.0) < 1e-6);
+    DOCTEST_CHECK_EQ(stats.getMin(), 200.0);
+    DOCTEST_CHECK_EQ(stats.getMax(), 900.0);
+
+    stats.record(-5.0);
+    DOCTEST_CHECK_EQ(stats.getMin(), 0.0);
+}
+
+DOCTEST_TEST_CASE("ReactionTimeStats - Percentis do histograma") {
+    ReactionTimeStats stats;
+    for (int i = 1; i <= 1000; ++i) {
+        stats.record(static_cast<double>(i));
+    }
+
+    // Erro relativo limitado pela resolução dos baldes (~3%)
+    DOCTEST_CHECK(std::fabs(stats.getPercentile(50.0) - 500.0) <= 500.0 * 0.035);
+    DOCTEST_CHECK(std::fabs(stats.getPercentile(90.0) - 900.0) <= 900.0 * 0.035);
+    DOCTEST_CHECK(std::fabs(stats.getPercentile(99.0) - 990.0) <= 990.0 * 0.035);
+    DOCTEST_CHECK_EQ(stats.getPercentile(100.0), 1000.0);
+    DOCTEST_CHECK_EQ(stats.getPercentile(0.0), 1.0);
+
+    DOCTEST_SUBCASE("Valores pequenos são exatos") {
+        ReactionTimeStats fine;
+        fine.record(0.010);
+        fine.record(0.020);
+        fine.record(0.030);
+        DOCTEST_CHECK(std::fabs(fine.getPercentile(50.0) - 0.020) < 1e-9);
+    }
+
+    DOCTEST_SUBCASE("Valores acima do limite ficam no último balde") {
+        ReactionTimeStats huge;
+        huge.record(1e12);
+        DOCTEST_CHECK_EQ(huge.getPercentile(99.0), 1e12);
+    }
+}
+
+DOCTEST_TEST_CASE("ReactionTimeStats - Combinação entre jogadores") {
+    ReactionTimeStats first, second, all;
+    for (int i = 0; i < 500; ++i) {
+        double fast = 150.0 + (i % 50);
+        double slow = 800.0 + (i % 100) * 2;
+        first.record(fast);
+        second.record(slow);
+        all.record(fast);
+        all.record(slow);
+    }
+
+    ReactionTimeStats merged(first);
+    merged.merge(second);
+    DOCTEST_CHECK_EQ(merged.getCount(), all.getCount());
+    DOCTEST_CHECK(std::fabs(merged.getMean() - all.getMean()) < 1e-9);
+    DOCTEST_CHECK(std::fabs(merged.getVariance() - all.getVariance()) < 1e-6);
+    DOCTEST_CHECK_EQ(merged.getMin(), all.getMin());
+    DOCTEST_CHECK_EQ(merged.getMax(), all.getMax());
+    DOCTEST_CHECK_EQ(merged.getPercentile(90.0), all.getPercentile(90.0));
+
+    ReactionTimeStats empty;
+    empty.merge(first);
+    DOCTEST_CHECK_EQ(empty.getPercentile(50.0), first.getPercentile(50.0));
+}
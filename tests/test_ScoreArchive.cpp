@@ -0,0 +1,188 @@
+/**
+ * @file test_ScoreArchive.cpp
+ * @brief Testes unitários para a classe ScoreArchive
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "ScoreArchive.h"
+#include "ScoreManager.h"
+#include <cstdio>
+#include <fstream>
+
+DOCTEST_TEST_CASE("ScoreArchive - Gravação e leitura") {
+    const std::string path = "test_archive.bin";
+
+    std::vector<ScoreRecord> records;
+    std::string texts;
+    for (int i = 0; i < 1000; ++i) {
+        ScoreEntry entry("Jogador" + std::to_string(i), 1000 - i, 1 + i % 7, "", 50.0 + i % 50,
+                         1000LL * i, i % 13, 1735725600LL + i);
+        records.push_back(ScoreArchive::toRecord(entry, texts));
+    }
+    DOCTEST_CHECK(texts.empty());
+    DOCTEST_CHECK(ScoreArchive::write(path, records, texts, 42));
+    DOCTEST_CHECK(ScoreArchive::isArchiveFile(path));
+
+    ScoreArchive archive;
+    DOCTEST_CHECK(archive.open(path));
+    DOCTEST_CHECK_EQ(archive.size(), 1000);
+    DOCTEST_CHECK_EQ(archive.getGeneration(), 42);
+    DOCTEST_CHECK_EQ(archive[0].score, 1000);
+    DOCTEST_CHECK_EQ(archive[999].timestamp, 1735725600LL + 999);
+
+    ScoreEntry entry = archive.getEntry(7);
+    DOCTEST_CHECK_EQ(entry.playerName, "Jogador7");
+    DOCTEST_CHECK_EQ(entry.level, 1);
+    DOCTEST_CHECK_EQ(entry.streak, 7);
+    DOCTEST_CHECK_EQ(entry.date, ScoreArchive::formatTimestamp(1735725607LL));
+    DOCTEST_CHECK_EQ(ScoreArchive::parseDate(entry.date), 1735725607LL - 1735725607LL % 60);
+    archive.close();
+    DOCTEST_CHECK(!archive.isOpen());
+
+    DOCTEST_SUBCASE("Checksum detecta corrupção") {
+        {
+            std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(sizeof(ScoreArchiveHeader) + 500 * sizeof(ScoreRecord) + 24);
+            file.put('\x7f');
+        }
+        DOCTEST_CHECK(!archive.open(path));
+        DOCTEST_CHECK(archive.open(path, false));
+        DOCTEST_CHECK_EQ(archive.size(), 1000);
+    }
+
+    DOCTEST_SUBCASE("Arquivo truncado é rejeitado") {
+        std::vector<ScoreRecord> shortList(records.begin(), records.begin() + 3);
+        DOCTEST_CHECK(ScoreArchive::write(path, shortList, texts));
+        {
+            std::ofstream append(path, std::ios::binary | std::ios::app);
+            append << "lixo";
+        }
+        DOCTEST_CHECK(!archive.open(path, false));
+        DOCTEST_CHECK(!ScoreArchive::isArchiveFile("arquivo_inexistente.bin"));
+    }
+
+    std::remove(path.c_str());
+}
+
+DOCTEST_TEST_CASE("ScoreManager - Snapshot binário") {
+    const std::string path = "test_binary_scores.dat";
+    std::remove(path.c_str());
+
+    {
+        ScoreManager manager(10, path, ScoreFileFormat::BINARY);
+        manager.addScore("Alice", 300);
+        manager.addScore("Bob", 500);
+        DOCTEST_CHECK(ScoreArchive::isArchiveFile(path));
+    }
+
+    // O formato é detectado na leitura, mesmo por um gerenciador que grava texto
+    ScoreManager reloaded(10, path);
+    DOCTEST_CHECK_EQ(reloaded.getTotalScores(), 2);
+    DOCTEST_CHECK_EQ(reloaded.getScores()[0].playerName, "Bob");
+    DOCTEST_CHECK_NE(reloaded.getScores()[0].timestamp, 0);
+    DOCTEST_CHECK_NE(reloaded.exportScores().find("Alice|300|"), std::string::npos);
+
+    // Log de acréscimo sobre o snapshot binário
+    DOCTEST_CHECK(reloaded.setFileFormat(ScoreFileFormat::BINARY));
+    DOCTEST_CHECK(reloaded.setLogMode(true));
+    reloaded.addScore("Carol", 400);
+    DOCTEST_CHECK(reloaded.removeScore(2));
+    {
+        ScoreManager replayed(10, path, ScoreFileFormat::BINARY);
+        DOCTEST_CHECK_EQ(replayed.getTotalScores(), 2);
+        DOCTEST_CHECK_EQ(replayed.getScores()[1].playerName, "Carol");
+        DOCTEST_CHECK(replayed.setLogMode(true));
+    }
+
+    std::remove(path.c_str());
+    std::remove((path + ".log").c_str());
+}
+
+DOCTEST_TEST_CASE("ScoreArchive - Datas que o timestamp não reproduz") {
+    const std::string path = "test_archive_dates.bin";
+    const long long now = 1735725600LL;
+
+    std::vector<ScoreEntry> entries;
+    entries.push_back(ScoreEntry("Formatada", 500, 3, ScoreArchive::formatTimestamp(now), 80.0, 1000, 4, now));
+    entries.push_back(ScoreEntry("Desconhecida", 400, 2, "Desconhecido", 70.0, 900, 3, 0));
+    entries.push_back(ScoreEntry("Iso", 300, 2, "2025-01-01 12:00", 60.0, 800, 2, 0));
+    entries.push_back(ScoreEntry("Segundos", 200, 1, "01/01/2025 12:00:30", 50.0, 700, 1, now));
+    entries.push_back(ScoreEntry("SemData", 100, 1, "", 40.0, 600, 0, 0));
+
+    std::vector<ScoreRecord> records;
+    std::string texts;
+    for (const auto& entry : entries) {
+        records.push_back(ScoreArchive::toRecord(entry, texts));
+    }
+    DOCTEST_CHECK_EQ(records[0].dateOffset, 0u);
+    DOCTEST_CHECK_NE(records[1].dateOffset, 0u);
+    DOCTEST_CHECK_EQ(records[4].dateOffset, 0u);
+    DOCTEST_CHECK(ScoreArchive::write(path, records, texts));
+
+    ScoreArchive archive;
+    DOCTEST_CHECK(archive.open(path));
+    DOCTEST_CHECK_EQ(archive.size(), entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        ScoreEntry loaded = archive.getEntry(i);
+        DOCTEST_CHECK_EQ(loaded.playerName, entries[i].playerName);
+        DOCTEST_CHECK_EQ(loaded.timestamp, entries[i].timestamp);
+        DOCTEST_CHECK_EQ(loaded.date, ScoreArchive::getEntryDate(entries[i]));
+    }
+    archive.close();
+
+    // Texto sem terminador no fim da área é rejeitado
+    {
+        std::ofstream append(path, std::ios::binary | std::ios::app);
+        append << "x";
+    }
+    DOCTEST_CHECK(!archive.open(path, false));
+
+    std::remove(path.c_str());
+}
+
+DOCTEST_TEST_CASE("ScoreManager - Conversão entre texto e binário preserva as datas") {
+    const std::string textPath = "test_dates_text.dat";
+    std::remove(textPath.c_str());
+    std::remove((textPath + ".log").c_str());
+
+    // Só as linhas de pontuação (o cabeçalho traz o instante da exportação)
+    auto exportedEntries = [](const ScoreManager& manager) {
+        std::string exported = manager.exportScores();
+        return exported.substr(exported.find("\n\n"));
+    };
+
+    {
+        std::ofstream file(textPath);
+        file << "Ana|500|3|Desconhecido|80.0|1000|4|0\n";
+        file << "Bia|400|2|2025-01-01 12:00|70.0|900|3|0\n";
+        file << "Caio|300|2|01/01/2025 12:00|60.0|800|2|1735732800\n";
+    }
+
+    ScoreManager text(10, textPath);
+    std::string original = exportedEntries(text);
+
+    {
+        ScoreManager writer(10, textPath);
+        DOCTEST_CHECK(writer.setFileFormat(ScoreFileFormat::BINARY));
+    }
+    DOCTEST_CHECK(ScoreArchive::isArchiveFile(textPath));
+
+    ScoreManager binary(10, textPath);
+    DOCTEST_CHECK_EQ(binary.getTotalScores(), 3);
+    DOCTEST_CHECK_EQ(binary.getScores()[0].date, "Desconhecido");
+    DOCTEST_CHECK_EQ(binary.getScores()[1].date, "2025-01-01 12:00");
+
+    // A API pública devolve as mesmas datas nos dois formatos
+    for (size_t i = 0; i < binary.getScores().size(); ++i) {
+        DOCTEST_CHECK_EQ(binary.getScores()[i].date, text.getScores()[i].date);
+    }
+    DOCTEST_CHECK_EQ(binary.getTopScore()->date, text.getTopScore()->date);
+    DOCTEST_CHECK_EQ(binary.getPlayerScores("Caio")[0].date, text.getPlayerScores("Caio")[0].date);
+    DOCTEST_CHECK_EQ(exportedEntries(binary), original);
+
+    std::remove(textPath.c_str());
+    std::remove((textPath + ".log").c_str());
+}
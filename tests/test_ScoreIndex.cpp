@@ -0,0 +1,85 @@
+/**
+ * @file test_ScoreIndex.cpp
+ * @brief Testes unitários para a classe ScoreIndex
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "ScoreIndex.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+DOCTEST_TEST_CASE("ScoreIndex - Consultas básicas") {
+    ScoreIndex index;
+    DOCTEST_CHECK_EQ(index.size(), 0);
+    DOCTEST_CHECK_EQ(index.rank(10), 1);
+    DOCTEST_CHECK_EQ(index.percentile(10), 0.0);
+
+    for (int score : {50, 10, 30, 30, 20, 30}) {
+        index.insert(score);
+    }
+    DOCTEST_CHECK_EQ(index.size(), 6);
+    DOCTEST_CHECK_EQ(index.countAbove(30), 1);
+    DOCTEST_CHECK_EQ(index.countBelow(30), 2);
+    DOCTEST_CHECK_EQ(index.countInRange(20, 30), 4);
+    DOCTEST_CHECK_EQ(index.countInRange(31, 49), 0);
+    DOCTEST_CHECK_EQ(index.rank(30), 2);
+    DOCTEST_CHECK_EQ(index.rank(60), 1);
+    DOCTEST_CHECK_EQ(index.rank(0), 7);
+    DOCTEST_CHECK_EQ(index.select(1), 50);
+    DOCTEST_CHECK_EQ(index.select(4), 30);
+    DOCTEST_CHECK_EQ(index.select(6), 10);
+    DOCTEST_CHECK(std::fabs(index.percentile(30) - 100.0 * 2 / 6) < 1e-9);
+
+    DOCTEST_CHECK(index.erase(30));
+    DOCTEST_CHECK(!index.erase(40));
+    DOCTEST_CHECK_EQ(index.countInRange(30, 30), 2);
+
+    index.clear();
+    DOCTEST_CHECK_EQ(index.size(), 0);
+    DOCTEST_CHECK_EQ(index.countAbove(0), 0);
+}
+
+DOCTEST_TEST_CASE("ScoreIndex - Equivalência com lista ordenada") {
+    ScoreIndex index;
+    std::vector<int> reference; // Ordem decrescente
+
+    unsigned state = 987654321u;
+    auto next = [&state]() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    };
+
+    bool consistent = true;
+    for (int step = 0; step < 20000; ++step) {
+        int score = static_cast<int>(next() % 2000);
+        if (next() % 3 != 0 || reference.empty()) {
+            index.insert(score);
+            reference.insert(std::upper_bound(reference.begin(), reference.end(), score,
+                                              std::greater<int>()), score);
+        } else {
+            // Remove um valor existente
+            int victim = reference[next() % reference.size()];
+            consistent = consistent && index.erase(victim);
+            reference.erase(std::find(reference.begin(), reference.end(), victim));
+        }
+
+        if (step % 97 == 0) {
+            size_t above = static_cast<size_t>(std::upper_bound(reference.begin(), reference.end(), score,
+                                                                std::greater<int>()) - reference.begin());
+            size_t k = 1 + next() % reference.size();
+            consistent = consistent && index.size() == reference.size() &&
+                         index.rank(score + 1) == 1 + static_cast<size_t>(
+                             std::lower_bound(reference.begin(), reference.end(), score + 1,
+                                              std::greater<int>()) - reference.begin()) &&
+                         index.countAbove(score) + index.countInRange(score, score) == above &&
+                         index.select(k) == reference[k - 1];
+        }
+    }
+    DOCTEST_CHECK(consistent);
+    DOCTEST_CHECK_EQ(index.size(), reference.size());
+}
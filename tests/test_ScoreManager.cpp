@@ -10,6 +10,8 @@
 #include "ScoreManager.h"
 #include <fstream>
 #include <cstdio>
+#include <iterator>
+#include <cmath>
 
 DOCTEST_TEST_CASE("ScoreManager - Construtor básico") {
     DOCTEST_SUBCASE("Construtor com parâmetros padrão") {
@@ -365,4 +367,198 @@ DOCTEST_TEST_CASE("ScoreManager - Construtor de cópia e atribuição") {
     }
     
     std::remove("test_copy.dat");
-}
\ No newline at end of file
+}
+DOCTEST_TEST_CASE("ScoreManager - Log de acréscimo") {
+    const std::string testFile = "test_log_scores.dat";
+    const std::string logFile = testFile + ".log";
+
+    auto readFile = [](const std::string& name) {
+        std::ifstream file(name);
+        return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    };
+
+    {
+        ScoreManager manager(10, testFile);
+        DOCTEST_CHECK(manager.setLogMode(true, 100));
+        DOCTEST_CHECK(manager.isLogMode());
+        std::string snapshot = readFile(testFile);
+
+        manager.addScore("Alice", 300);
+        manager.addScore("Bob", 500);
+        manager.addScore("Carol", 400);
+        manager.addScore("alice", 100);
+        DOCTEST_CHECK(manager.removeScore(0));        // Bob
+        DOCTEST_CHECK_EQ(manager.removePlayerScores("ALICE"), 2);
+        DOCTEST_CHECK_EQ(manager.getLogRecordCount(), 6);
+
+        // O snapshot não é regravado a cada alteração
+        DOCTEST_CHECK_EQ(readFile(testFile), snapshot);
+    }
+
+    {
+        // Registro completo seguido de um registro interrompido no meio da gravação
+        std::ofstream log(logFile, std::ios::app);
+        log << "A|Dave|900|1|01/01/2025 10:00|50.0|1000|1\n";
+        log << "A|Eve|950|1|01/01/20";
+    }
+
+    {
+        // Snapshot mais log reconstroem o ranking; o registro incompleto é ignorado
+        ScoreManager reloaded(10, testFile);
+        DOCTEST_CHECK(!reloaded.isLogMode());
+        DOCTEST_CHECK_EQ(reloaded.getTotalScores(), 2);
+        DOCTEST_CHECK_EQ(reloaded.getScores()[0].playerName, "Dave");
+        DOCTEST_CHECK_EQ(reloaded.getScores()[1].playerName, "Carol");
+        DOCTEST_CHECK_EQ(reloaded.getLogRecordCount(), 7);
+    }
+
+    {
+        // Compactação incorpora o log a um novo snapshot
+        ScoreManager manager(10, testFile);
+        DOCTEST_CHECK(manager.setLogMode(true, 3));
+        manager.addScore("P1", 10);
+        manager.addScore("P2", 20);
+        DOCTEST_CHECK_EQ(manager.getLogRecordCount(), 2);
+        manager.addScore("P3", 30);
+        DOCTEST_CHECK_EQ(manager.getLogRecordCount(), 0);
+
+        // Um log de geração anterior (compactação interrompida) não é reaplicado
+        {
+            std::ofstream stale(logFile);
+            stale << "# Generation: 1\nC\n";
+        }
+        ScoreManager reloaded(10, testFile);
+        DOCTEST_CHECK_EQ(reloaded.getTotalScores(), manager.getTotalScores());
+        DOCTEST_CHECK_EQ(reloaded.getTotalScores(), 5);
+        DOCTEST_CHECK_EQ(reloaded.getScores()[2].playerName, "P3");
+
+        DOCTEST_CHECK(manager.setLogMode(false));
+        std::ifstream removed(logFile);
+        DOCTEST_CHECK(!removed.is_open());
+    }
+
+    std::remove(testFile.c_str());
+    std::remove(logFile.c_str());
+}
+
+DOCTEST_TEST_CASE("ScoreManager - Ranking com limite grande") {
+    std::string testFile = "test_scores_topk.dat";
+    std::string logFile = testFile + ".log";
+    std::remove(testFile.c_str());
+    std::remove(logFile.c_str());
+
+    {
+        ScoreManager manager(1000000, testFile);
+        DOCTEST_CHECK(manager.setLogMode(true));
+        for (int i = 0; i < 3000; ++i) {
+            manager.addScore("P" + std::to_string(i), (i * 7919) % 5000);
+        }
+        DOCTEST_CHECK_EQ(manager.getTotalScores(), 3000);
+
+        // A colocação retornada é a posição real da entrada
+        auto result = manager.addScore("Novo", 2500);
+        int rank = std::stoi(result["rank"]);
+        DOCTEST_CHECK_GT(rank, 0);
+        DOCTEST_CHECK_EQ(manager.getScores()[rank - 1].playerName, "Novo");
+        DOCTEST_CHECK_EQ(manager.getScores()[rank - 2].score, 2500); // Empates anteriores à frente
+        DOCTEST_CHECK(manager.setLogMode(false));
+    }
+
+    {
+        // Ranking cheio: pontuações que não entram não alteram nada nem geram registro
+        ScoreManager manager(3, testFile);
+        DOCTEST_CHECK_EQ(manager.getTotalScores(), 3);
+        DOCTEST_CHECK(manager.setLogMode(true));
+        int lowest = manager.getScores().back().score;
+
+        auto result = manager.addScore("Baixo", lowest - 1);
+        DOCTEST_CHECK_EQ(result["success"], "true");
+        DOCTEST_CHECK_EQ(result["rank"], "0");
+        DOCTEST_CHECK_EQ(manager.getLogRecordCount(), 0);
+
+        result = manager.addScore("Alto", manager.getTopScore()->score + 1);
+        DOCTEST_CHECK_EQ(result["rank"], "1");
+        DOCTEST_CHECK_EQ(result["isNewRecord"], "true");
+        DOCTEST_CHECK_EQ(manager.getTotalScores(), 3);
+        DOCTEST_CHECK_EQ(manager.getLogRecordCount(), 1);
+        DOCTEST_CHECK(manager.setLogMode(false));
+    }
+
+    std::remove(testFile.c_str());
+    std::remove(logFile.c_str());
+}
+
+DOCTEST_TEST_CASE("ScoreManager - Consultas de colocação e percentil") {
+    std::string testFile = "test_scores_rank.dat";
+    std::remove(testFile.c_str());
+
+    ScoreManager manager(5, testFile);
+    DOCTEST_CHECK_EQ(manager.getRankForScore(100), 1);
+    DOCTEST_CHECK_EQ(manager.getScoreAtRank(1), -1);
+    DOCTEST_CHECK_EQ(manager.getPercentile(100), 0.0);
+
+    manager.addScore("A", 100);
+    manager.addScore("B", 300);
+    manager.addScore("C", 200);
+    manager.addScore("D", 200);
+    auto result = manager.addScore("E", 50);
+    DOCTEST_CHECK_EQ(result["percentile"], "0.0");
+
+    DOCTEST_CHECK_EQ(manager.getRankForScore(400), 1);
+    DOCTEST_CHECK_EQ(manager.getRankForScore(200), 2);
+    DOCTEST_CHECK_EQ(manager.getRankForScore(150), 4);
+    DOCTEST_CHECK_EQ(manager.getScoreAtRank(3), 200);
+    DOCTEST_CHECK_EQ(manager.getScoreAtRank(5), 50);
+    DOCTEST_CHECK_EQ(manager.getScoreAtRank(6), -1);
+    DOCTEST_CHECK_EQ(manager.countScoresInRange(100, 200), 3);
+    DOCTEST_CHECK_EQ(manager.countScoresInRange(300, 100), 0);
+    DOCTEST_CHECK(std::fabs(manager.getPercentile(200) - 40.0) < 1e-9);
+
+    // Descarte por capacidade, remoção e importação mantêm o índice
+    manager.addScore("F", 250);
+    DOCTEST_CHECK_EQ(manager.countScoresInRange(0, 60), 0);
+    DOCTEST_CHECK(manager.removeScore(0));
+    DOCTEST_CHECK_EQ(manager.getScoreAtRank(1), 250);
+    DOCTEST_CHECK_EQ(manager.removePlayerScores("c"), 1);
+    DOCTEST_CHECK_EQ(manager.countScoresInRange(200, 200), 1);
+
+    manager.importScores("X|500|1|01/01/2025 10:00|50.0|1000|1\n", false);
+    DOCTEST_CHECK_EQ(manager.getTotalScores(), 1);
+    DOCTEST_CHECK_EQ(manager.getScoreAtRank(1), 500);
+    DOCTEST_CHECK_EQ(manager.getRankForScore(200), 2);
+
+    DOCTEST_CHECK(manager.clearScores());
+    DOCTEST_CHECK_EQ(manager.countScoresInRange(0, 1000), 0);
+
+    std::remove(testFile.c_str());
+}
+
+DOCTEST_TEST_CASE("ScoreManager - Remoção registrada no log identifica a entrada") {
+    std::string testFile = "test_scores_log_remove.dat";
+    std::string logFile = testFile + ".log";
+    std::remove(testFile.c_str());
+    std::remove(logFile.c_str());
+
+    {
+        ScoreManager manager(10, testFile);
+        DOCTEST_CHECK(manager.setLogMode(true));
+
+        // Mesmo jogador, mesma pontuação e mesmo minuto; só o nível difere
+        manager.addScore("Ana", 100, {{"level", "5"}});
+        manager.addScore("Ana", 100, {{"level", "2"}});
+        DOCTEST_CHECK_EQ(manager.getScores()[1].level, 2);
+        DOCTEST_CHECK(manager.removeScore(1));
+        DOCTEST_CHECK_EQ(manager.getTotalScores(), 1);
+        DOCTEST_CHECK_EQ(manager.getScores()[0].level, 5);
+    }
+
+    {
+        ScoreManager reloaded(10, testFile);
+        DOCTEST_CHECK_EQ(reloaded.getTotalScores(), 1);
+        DOCTEST_CHECK_EQ(reloaded.getScores()[0].level, 5);
+        DOCTEST_CHECK(reloaded.setLogMode(false));
+    }
+
+    std::remove(testFile.c_str());
+    std::remove(logFile.c_str());
+}
@@ -0,0 +1,75 @@
+/**
+ * @file test_SequenceBatch.cpp
+ * @brief Testes unitários para a classe SequenceBatch
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "SequenceBatch.h"
+
+DOCTEST_TEST_CASE("SequenceBatch - Construção e sessões") {
+    SequenceBatch batch({"A", "B", "C"}, 99, 5);
+    DOCTEST_CHECK_EQ(batch.size(), 0);
+
+    DOCTEST_CHECK_EQ(batch.addSession(7), 0);
+    DOCTEST_CHECK_EQ(batch.addSessions(100, 3), 1);
+    DOCTEST_CHECK_EQ(batch.size(), 4);
+    DOCTEST_CHECK_EQ(batch.getSessionId(0), 7);
+    DOCTEST_CHECK_EQ(batch.getSessionId(3), 102);
+    DOCTEST_CHECK_EQ(batch.getLength(2), 0);
+
+    DOCTEST_CHECK_THROWS(SequenceBatch({}, 1));
+    DOCTEST_CHECK_THROWS(SequenceBatch({"A", "A"}, 1));
+}
+
+DOCTEST_TEST_CASE("SequenceBatch - Equivalência com SequenceGenerator") {
+    const uint64_t seed = 0xC0FFEEULL;
+    SequenceBatch batch({"A", "B", "C", "D", "E"}, seed, 50);
+    batch.addSessions(1000, 130); // Mais de um bloco, com bloco parcial
+
+    for (int round = 0; round < 12; ++round) {
+        DOCTEST_CHECK_EQ(batch.extendAll(), 130);
+    }
+
+    for (size_t slot = 0; slot < batch.size(); slot += 17) {
+        SequenceGenerator single({"A", "B", "C", "D", "E"}, 1);
+        single.setSeed(seed, batch.getSessionId(slot));
+
+        DOCTEST_CHECK_EQ(batch.getLength(slot), 12);
+        for (size_t i = 0; i < batch.getLength(slot); ++i) {
+            DOCTEST_CHECK_EQ(batch.getSymbolId(slot, i), single.symbolIdForIndex(i));
+        }
+    }
+
+    SequenceGenerator converted = batch.toGenerator(5);
+    DOCTEST_CHECK_EQ(converted.getSequenceLength(), 12);
+    DOCTEST_CHECK_EQ(converted.getSessionId(), batch.getSessionId(5));
+    DOCTEST_CHECK_EQ(converted.getSymbolIdAt(11), batch.getSessionSymbols(5)[11]);
+
+    // A sessão convertida continua a mesma sequência individualmente
+    batch.extendAll();
+    converted.addRandomElement();
+    DOCTEST_CHECK_EQ(converted.getSymbolIdAt(12), batch.getSymbolId(5, 12));
+
+    DOCTEST_CHECK_THROWS(batch.toGenerator(500));
+}
+
+DOCTEST_TEST_CASE("SequenceBatch - Comprimento máximo") {
+    SequenceBatch batch({"A", "B"}, 1, 3);
+    batch.addSessions(0, 4);
+
+    for (int i = 0; i < 3; ++i) {
+        DOCTEST_CHECK_EQ(batch.extendAll(), 4);
+    }
+    DOCTEST_CHECK_EQ(batch.extendAll(), 0);
+    DOCTEST_CHECK_EQ(batch.getLength(3), 3);
+
+    batch.addSession(9);
+    DOCTEST_CHECK_EQ(batch.extendAll(), 1);
+
+    batch.clear();
+    DOCTEST_CHECK_EQ(batch.size(), 0);
+    DOCTEST_CHECK_EQ(batch.extendAll(), 0);
+}
@@ -8,7 +8,12 @@
 
 #include "doctest.h"
 #include "SequenceGenerator.h"
+#include "SequenceValidator.h"
 #include <stdexcept>
+#include <climits>
+#include <type_traits>
+#include <cstring>
+#include <cstddef>
 
 DOCTEST_TEST_CASE("SequenceGenerator - Construtor básico") {
     DOCTEST_SUBCASE("Construtor com parâmetros padrão") {
@@ -141,6 +146,30 @@ DOCTEST_TEST_CASE("SequenceGenerator - Estatísticas") {
         DOCTEST_CHECK_EQ(stats["uniqueColors"], 2);
         DOCTEST_CHECK_GE(stats["mostFrequentCount"], 1);
     }
+
+    DOCTEST_SUBCASE("Estatísticas tipadas e incrementais") {
+        SequenceStats stats = generator.getStats();
+        DOCTEST_CHECK_EQ(stats.length, 4);
+        DOCTEST_CHECK_EQ(stats.uniqueColors, 2);
+        DOCTEST_CHECK_EQ(stats.mostFrequentCount, 3);
+        DOCTEST_CHECK_EQ(stats.leastFrequentCount, 1);
+        DOCTEST_CHECK_EQ(generator.getSymbolCounts()[0], 3);
+
+        generator.addRandomElement();
+        stats = generator.getStats();
+        DOCTEST_CHECK_EQ(stats.length, 5);
+        DOCTEST_CHECK_EQ(generator.getSymbolCounts()[0] + generator.getSymbolCounts()[1], 5);
+
+        generator.setCustomSequence({});
+        stats = generator.getStats();
+        DOCTEST_CHECK_EQ(stats.uniqueColors, 0);
+        DOCTEST_CHECK_EQ(stats.mostFrequentCount, 0);
+        DOCTEST_CHECK_EQ(generator.getSequenceStats()["leastFrequentCount"], INT_MAX);
+
+        generator.reset();
+        DOCTEST_CHECK_EQ(generator.getStats().uniqueColors, 1);
+        DOCTEST_CHECK_EQ(generator.getStats().mostFrequentCount, 1);
+    }
 }
 
 DOCTEST_TEST_CASE("SequenceGenerator - Operadores") {
@@ -210,4 +239,258 @@ DOCTEST_TEST_CASE("SequenceGenerator - Construtor de cópia e atribuição") {
         DOCTEST_CHECK_EQ(assigned.getSequenceLength(), original.getSequenceLength());
         DOCTEST_CHECK_EQ(assigned.getAvailableColors().size(), original.getAvailableColors().size());
     }
+
+    DOCTEST_SUBCASE("Movimentação") {
+        SequenceGenerator source(original);
+        SequenceGenerator moved(std::move(source));
+        DOCTEST_CHECK(moved == original);
+        DOCTEST_CHECK_EQ(moved.getStats().length, original.getSequenceLength());
+        DOCTEST_CHECK_EQ(source.getSequenceLength(), 0);
+
+        // A origem continua utilizável após reset()
+        source.reset();
+        DOCTEST_CHECK_EQ(source.getSequenceLength(), 2);
+
+        SequenceGenerator target({"X"}, 1);
+        target = std::move(moved);
+        DOCTEST_CHECK(target == original);
+
+        // Sem reset(), os contadores são recriados no primeiro elemento
+        SequenceGenerator drained(std::move(target));
+        target.addRandomElement();
+        DOCTEST_CHECK_EQ(target.getSequenceLength(), 1);
+        DOCTEST_CHECK_EQ(target.getStats().uniqueColors, 1);
+        DOCTEST_CHECK_EQ(target.getSymbolCounts().size(), 3);
+    }
+
+    DOCTEST_SUBCASE("Movimentação sem exceções") {
+        DOCTEST_CHECK(std::is_nothrow_move_constructible<SequenceGenerator>::value);
+        DOCTEST_CHECK(std::is_nothrow_move_assignable<SequenceGenerator>::value);
+        DOCTEST_CHECK(std::is_nothrow_move_constructible<PackedSequence>::value);
+        DOCTEST_CHECK(std::is_nothrow_move_assignable<PackedSequence>::value);
+
+        // Ao crescer, o vetor move os geradores em vez de copiá-los
+        std::vector<SequenceGenerator> lobby;
+        for (int i = 0; i < 17; ++i) {
+            lobby.push_back(original.clone());
+        }
+        DOCTEST_CHECK(lobby[0] == original);
+        DOCTEST_CHECK(lobby[16] == original);
+    }
+
+    DOCTEST_SUBCASE("Clones compartilham o alfabeto") {
+        original.setSeed(77, 3);
+        std::vector<SequenceGenerator> lobby;
+        for (int i = 0; i < 4; ++i) {
+            lobby.push_back(original.clone());
+        }
+        for (auto& player : lobby) {
+            DOCTEST_CHECK(player == original);
+            DOCTEST_CHECK_EQ(&player.getSymbolName(0), &original.getSymbolName(0));
+            DOCTEST_CHECK_EQ(player.addRandomElement(), original.previewNextElement());
+        }
+
+        // Trocar o alfabeto de um clone não afeta os demais
+        lobby[0].updateAvailableColors({"X", "Y"});
+        DOCTEST_CHECK_EQ(original.getSymbolName(0), "A");
+        DOCTEST_CHECK_EQ(lobby[1].getSymbolName(0), "A");
+    }
+}
+
+DOCTEST_TEST_CASE("SequenceGenerator - Identificadores de símbolos") {
+    SequenceGenerator generator({"A", "B", "C"}, 1);
+    generator.setCustomSequence({"C", "A", "B"});
+
+    DOCTEST_SUBCASE("Conversão entre nomes e identificadores") {
+        DOCTEST_CHECK_EQ(generator.findSymbolId("A"), 0);
+        DOCTEST_CHECK_EQ(generator.findSymbolId("C"), 2);
+        DOCTEST_CHECK_EQ(generator.findSymbolId("X"), SequenceGenerator::INVALID_SYMBOL);
+        DOCTEST_CHECK_EQ(generator.getSymbolName(1), "B");
+    }
+
+    DOCTEST_SUBCASE("Sequência armazenada como bytes") {
+        const auto& ids = generator.getSymbolIds();
+        DOCTEST_CHECK_EQ(ids.size(), 3);
+        DOCTEST_CHECK_EQ(generator.getSymbolIdAt(0), 2);
+        DOCTEST_CHECK_EQ(generator.getSymbolIdAt(1), 0);
+        DOCTEST_CHECK_EQ(generator.getSymbolIdAt(99), SequenceGenerator::INVALID_SYMBOL);
+        DOCTEST_CHECK_EQ(generator.getElementAt(0), "C");
+    }
+
+    DOCTEST_SUBCASE("Validação por identificadores") {
+        std::vector<uint8_t> correct = {2, 0, 1};
+        auto result = generator.validateUserSequence(correct);
+        DOCTEST_CHECK(result.first);
+        DOCTEST_CHECK_EQ(result.second, 2);
+
+        std::vector<uint8_t> wrong = {2, 1, 1};
+        result = generator.validateUserSequence(wrong);
+        DOCTEST_CHECK(!result.first);
+        DOCTEST_CHECK_EQ(result.second, 1);
+
+        std::vector<uint8_t> tooLong = {2, 0, 1, 0};
+        result = generator.validateUserSequence(tooLong);
+        DOCTEST_CHECK(!result.first);
+        DOCTEST_CHECK_EQ(result.second, 3);
+    }
+
+    DOCTEST_SUBCASE("Alfabeto grande demais") {
+        std::vector<std::string> hugeAlphabet;
+        for (int i = 0; i < 300; ++i) {
+            hugeAlphabet.push_back("S" + std::to_string(i));
+        }
+        DOCTEST_CHECK_THROWS(SequenceGenerator(hugeAlphabet));
+    }
+}
+
+DOCTEST_TEST_CASE("SequenceValidator - Validação incremental") {
+    SequenceGenerator generator;
+    generator.setCustomSequence({"C", "A", "B"});
+    SequenceValidator validator(generator);
+
+    DOCTEST_CHECK_EQ(validator.getPosition(), 0);
+    DOCTEST_CHECK_EQ(validator.getExpectedSymbol(), "C");
+
+    DOCTEST_CHECK(validator.advance("C") == ValidationResult::CORRECT);
+    DOCTEST_CHECK(validator.advance("B") == ValidationResult::WRONG);
+    DOCTEST_CHECK_EQ(validator.getPosition(), 1); // Erro não avança o cursor
+
+    DOCTEST_CHECK(validator.advance(static_cast<uint8_t>(0)) == ValidationResult::CORRECT);
+    DOCTEST_CHECK(validator.advance("B") == ValidationResult::COMPLETE);
+    DOCTEST_CHECK(validator.isComplete());
+    DOCTEST_CHECK_EQ(validator.getExpectedSymbol(), "");
+    DOCTEST_CHECK(validator.advance("A") == ValidationResult::WRONG);
+
+    // A sequência pode crescer sem recriar o validador
+    generator.addRandomElement();
+    DOCTEST_CHECK(!validator.isComplete());
+    validator.reset();
+    DOCTEST_CHECK_EQ(validator.getPosition(), 0);
+    DOCTEST_CHECK(validator.advance("X") == ValidationResult::WRONG);
+}
+
+DOCTEST_TEST_CASE("SequenceGenerator - Semente determinística") {
+    SequenceGenerator first({"A", "B", "C", "D"}, 3);
+    SequenceGenerator second({"A", "B", "C", "D"}, 3);
+    first.setSeed(2025, 10);
+    second.setSeed(2025, 10);
+
+    DOCTEST_CHECK_EQ(first.getSeed(), 2025);
+    DOCTEST_CHECK_EQ(first.getSessionId(), 10);
+    DOCTEST_CHECK(first == second);
+
+    DOCTEST_SUBCASE("Elemento i depende apenas de (semente, sessão, i)") {
+        DOCTEST_CHECK_EQ(first.previewNextElement(), first.getSymbolName(first.symbolIdForIndex(3)));
+        for (int i = 0; i < 20; ++i) {
+            first.addRandomElement();
+        }
+        DOCTEST_CHECK_EQ(first.getSymbolIdAt(22), second.symbolIdForIndex(22));
+    }
+
+    DOCTEST_SUBCASE("Cópia preserva semente e sessão") {
+        SequenceGenerator copy(second);
+        DOCTEST_CHECK_EQ(copy.getSeed(), second.getSeed());
+        DOCTEST_CHECK_EQ(copy.addRandomElement(), second.addRandomElement());
+    }
+
+    DOCTEST_SUBCASE("Reset avança para a próxima sessão") {
+        SequenceGenerator replay(second);
+        second.reset();
+        DOCTEST_CHECK_EQ(second.getSessionId(), 11);
+        replay.setSeed(2025, 11);
+        DOCTEST_CHECK(second == replay);
+    }
+}
+
+DOCTEST_TEST_CASE("SequenceGenerator - Snapshot binário") {
+    SequenceGenerator original({"A", "B", "C"}, 2, 500);
+    original.setSeed(31337, 4);
+    original.setPackedStorage(true);
+    for (int i = 0; i < 100; ++i) {
+        original.addRandomElement();
+    }
+
+    std::vector<uint8_t> data = original.snapshot();
+    DOCTEST_CHECK_EQ(data.size(), original.getSnapshotSize());
+
+    DOCTEST_SUBCASE("Restaurar reproduz o estado e a continuação") {
+        SequenceGenerator restored({"A", "B", "C"});
+        DOCTEST_CHECK(restored.restore(data));
+        DOCTEST_CHECK(restored == original);
+        DOCTEST_CHECK_EQ(restored.getSeed(), 31337);
+        DOCTEST_CHECK_EQ(restored.getSessionId(), 4);
+        DOCTEST_CHECK(restored.isPackedStorage());
+        DOCTEST_CHECK(restored.getSymbolCounts() == original.getSymbolCounts());
+        DOCTEST_CHECK_EQ(restored.getStats().leastFrequentCount, original.getStats().leastFrequentCount);
+        DOCTEST_CHECK_EQ(restored.addRandomElement(), original.addRandomElement());
+    }
+
+    DOCTEST_SUBCASE("Snapshots inválidos não alteram o estado") {
+        SequenceGenerator target({"A", "B", "C"}, 1);
+        std::string before = target.toString();
+
+        std::vector<uint8_t> corrupted = data;
+        corrupted.back() ^= 0x01;
+        DOCTEST_CHECK(!target.restore(corrupted));
+
+        std::vector<uint8_t> truncated(data.begin(), data.end() - 8);
+        DOCTEST_CHECK(!target.restore(truncated));
+        DOCTEST_CHECK(!target.restore(nullptr, 0));
+
+        SequenceGenerator otherAlphabet({"A", "B", "D"});
+        DOCTEST_CHECK(!otherAlphabet.restore(data));
+
+        DOCTEST_CHECK_EQ(target.toString(), before);
+    }
+
+    DOCTEST_SUBCASE("Snapshots com soma válida mas conteúdo incoerente") {
+        // Recalcula a soma (FNV-1a por palavra de 64 bits) após uma alteração
+        auto resign = [](std::vector<uint8_t>& bytes) {
+            uint64_t hash = 0xcbf29ce484222325ULL;
+            for (size_t i = sizeof(SequenceSnapshotHeader); i < bytes.size(); i += sizeof(uint64_t)) {
+                uint64_t word;
+                std::memcpy(&word, bytes.data() + i, sizeof(word));
+                hash = (hash ^ word) * 0x100000001b3ULL;
+            }
+            std::memcpy(bytes.data() + offsetof(SequenceSnapshotHeader, checksum), &hash, sizeof(hash));
+        };
+        const size_t countsOffset = sizeof(SequenceSnapshotHeader);
+        const size_t wordsOffset = countsOffset + 16;  // 3 contagens + preenchimento
+
+        std::vector<uint8_t> resigned = data;
+        resign(resigned);
+        SequenceGenerator target({"A", "B", "C"}, 1);
+        DOCTEST_CHECK(target.restore(resigned));
+
+        // Identificador 3 (fora do alfabeto) no lugar do primeiro elemento
+        std::vector<uint8_t> badSymbol = data;
+        badSymbol[wordsOffset] |= 0x03;
+        resign(badSymbol);
+        SequenceGenerator first({"A", "B", "C"}, 1);
+        std::string before = first.toString();
+        DOCTEST_CHECK(!first.restore(badSymbol));
+        DOCTEST_CHECK_EQ(first.toString(), before);
+
+        // Contagens com o total certo mas distribuídas de outra forma
+        std::vector<uint8_t> badCounts = data;
+        uint32_t counts[2];
+        std::memcpy(counts, badCounts.data() + countsOffset, sizeof(counts));
+        ++counts[0];
+        --counts[1];
+        std::memcpy(badCounts.data() + countsOffset, counts, sizeof(counts));
+        resign(badCounts);
+        DOCTEST_CHECK(!first.restore(badCounts));
+        DOCTEST_CHECK_EQ(first.toString(), before);
+    }
+
+    DOCTEST_SUBCASE("Buffer fornecido pelo chamador") {
+        std::vector<uint8_t> buffer(original.getSnapshotSize() + 1);
+        DOCTEST_CHECK_EQ(original.writeSnapshot(buffer.data(), 10), 0);
+        // Destino desalinhado
+        DOCTEST_CHECK_EQ(original.writeSnapshot(buffer.data() + 1, buffer.size() - 1), original.getSnapshotSize());
+
+        SequenceGenerator restored({"A", "B", "C"});
+        DOCTEST_CHECK(restored.restore(buffer.data() + 1, original.getSnapshotSize()));
+        DOCTEST_CHECK(restored == original);
+    }
 }
@@ -0,0 +1,115 @@
+/**
+ * @file test_SessionArena.cpp
+ * @brief Testes unitários para a classe SessionArena
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "SessionArena.h"
+#include "SimonEngine.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Objeto que registra a ordem de destruição
+ */
+struct Tracked {
+    std::vector<int>* log;
+    int id;
+    Tracked(std::vector<int>* l, int i) : log(l), id(i) {}
+    ~Tracked() { log->push_back(id); }
+};
+
+} // namespace
+
+DOCTEST_TEST_CASE("SessionArena - Alocação e alinhamento") {
+    SessionArena arena(1024);
+    DOCTEST_CHECK_EQ(arena.getBlockCount(), 0);
+
+    char* first = static_cast<char*>(arena.allocate(3, 1));
+    double* value = static_cast<double*>(arena.allocate(sizeof(double), alignof(double)));
+    DOCTEST_CHECK_EQ(reinterpret_cast<uintptr_t>(value) % alignof(double), 0);
+    DOCTEST_CHECK_GT(reinterpret_cast<char*>(value), first);
+    DOCTEST_CHECK_EQ(arena.getBlockCount(), 1);
+
+    // Requisição maior que um bloco recebe um bloco próprio
+    void* large = arena.allocate(4096, 64);
+    DOCTEST_CHECK_EQ(reinterpret_cast<uintptr_t>(large) % 64, 0);
+    DOCTEST_CHECK_EQ(arena.getBlockCount(), 2);
+    DOCTEST_CHECK_GE(arena.getBytesUsed(), 4096 + 3 + sizeof(double));
+}
+
+DOCTEST_TEST_CASE("SessionArena - Destruição e reaproveitamento") {
+    std::vector<int> log;
+    SessionArena arena(256);
+
+    for (int i = 0; i < 50; ++i) {
+        arena.create<Tracked>(&log, i);
+    }
+    int* plain = arena.create<int>(7);
+    DOCTEST_CHECK_EQ(*plain, 7);
+    DOCTEST_CHECK_EQ(arena.getObjectCount(), 50);
+    DOCTEST_CHECK_GT(arena.getBlockCount(), 1);
+
+    arena.release();
+    DOCTEST_CHECK_EQ(log.size(), 50);
+    DOCTEST_CHECK_EQ(log.front(), 49);
+    DOCTEST_CHECK_EQ(log.back(), 0);
+    DOCTEST_CHECK_EQ(arena.getObjectCount(), 0);
+    DOCTEST_CHECK_EQ(arena.getBytesUsed(), 0);
+
+    // Os blocos viram um só, suficiente para repetir a mesma sessão
+    DOCTEST_CHECK_EQ(arena.getBlockCount(), 1);
+    size_t capacity = arena.getCapacity();
+    for (int i = 0; i < 50; ++i) {
+        arena.create<Tracked>(&log, i);
+    }
+    DOCTEST_CHECK_EQ(arena.getBlockCount(), 1);
+    DOCTEST_CHECK_EQ(arena.getCapacity(), capacity);
+}
+
+DOCTEST_TEST_CASE("SessionArena - Destrutor com vários blocos") {
+    std::vector<int> log;
+    {
+        SessionArena arena(256);
+        for (int i = 0; i < 50; ++i) {
+            arena.create<Tracked>(&log, i);
+        }
+        DOCTEST_CHECK_GT(arena.getBlockCount(), 1);
+    }
+    DOCTEST_CHECK_EQ(log.size(), 50);
+    DOCTEST_CHECK_EQ(log.front(), 49);
+    DOCTEST_CHECK_EQ(log.back(), 0);
+}
+
+DOCTEST_TEST_CASE("SessionArena - Partida completa na arena") {
+    SessionArena arena;
+
+    for (int session = 0; session < 3; ++session) {
+        SequenceGenerator* generator = arena.create<SequenceGenerator>(
+            std::vector<std::string>{"A", "B", "C", "D"}, 1);
+        Player* player = arena.create<Player>("Arena", 3);
+        SimonEngine* engine = arena.create<SimonEngine>(*generator, *player);
+
+        engine->startGame();
+        for (int round = 0; round < 5; ++round) {
+            auto sequence = generator->getCurrentSequence();
+            for (const auto& symbol : sequence) {
+                engine->step(symbol);
+            }
+        }
+        DOCTEST_CHECK_EQ(player->getStats().totalCorrectSequences, 5);
+        DOCTEST_CHECK_EQ(player->getName(), "Arena");
+
+        // Cópias de um jogador da arena sobrevivem ao release()
+        Player copy(*player);
+        arena.release();
+        DOCTEST_CHECK_EQ(copy.getStats().totalCorrectSequences, 5);
+        DOCTEST_CHECK_EQ(arena.getBlockCount(), 1);
+    }
+}
@@ -0,0 +1,143 @@
+/**
+ * @file test_SimonEngine.cpp
+ * @brief Testes unitários para a classe SimonEngine
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "SimonEngine.h"
+
+namespace {
+
+/**
+ * @brief Verifica se a lista de eventos contém um evento do tipo informado
+ */
+bool hasEvent(const std::vector<EngineEvent>& events, EngineEventType type) {
+    for (const auto& event : events) {
+        if (event.type == type) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Digita corretamente toda a sequência atual
+ */
+const std::vector<EngineEvent>& playRound(SimonEngine& engine, const SequenceGenerator& generator) {
+    size_t length = generator.getSequenceLength();
+    for (size_t i = 0; i + 1 < length; ++i) {
+        engine.step(generator.getElementAt(i));
+    }
+    return engine.step(generator.getElementAt(length - 1));
+}
+
+/**
+ * @brief Obtém um símbolo diferente do esperado na posição atual
+ */
+std::string wrongSymbol(const SequenceGenerator& generator, size_t index) {
+    return generator.getElementAt(index) == "A" ? "B" : "A";
+}
+
+} // namespace
+
+DOCTEST_TEST_CASE("SimonEngine - Início de jogo") {
+    SequenceGenerator generator;
+    Player player("Bot", 3);
+    SimonEngine engine(generator, player);
+
+    DOCTEST_CHECK(engine.getPhase() == EnginePhase::IDLE);
+
+    const auto& events = engine.startGame("Robo");
+    DOCTEST_CHECK_EQ(events.size(), 1);
+    DOCTEST_CHECK(events[0].type == EngineEventType::ROUND_STARTED);
+    DOCTEST_CHECK_EQ(events[0].position, 2);
+    DOCTEST_CHECK(engine.isWaitingInput());
+    DOCTEST_CHECK_EQ(engine.getInputIndex(), 0);
+    DOCTEST_CHECK_EQ(player.getName(), "Robo");
+}
+
+DOCTEST_TEST_CASE("SimonEngine - Rodada correta") {
+    SequenceGenerator generator;
+    Player player("Bot", 3);
+    SimonEngine engine(generator, player);
+    engine.startGame();
+
+    const auto& first = engine.step(generator.getElementAt(0));
+    DOCTEST_CHECK_EQ(first.size(), 1);
+    DOCTEST_CHECK(first[0].type == EngineEventType::INPUT_CORRECT);
+    DOCTEST_CHECK_EQ(engine.getInputIndex(), 1);
+
+    const auto& last = engine.step(generator.getElementAt(1));
+    DOCTEST_CHECK(hasEvent(last, EngineEventType::SEQUENCE_COMPLETE));
+    DOCTEST_CHECK(hasEvent(last, EngineEventType::ROUND_STARTED));
+    DOCTEST_CHECK_EQ(generator.getSequenceLength(), 3);
+    DOCTEST_CHECK_EQ(player.getLevel(), 2);
+    DOCTEST_CHECK_GT(player.getScore(), 0);
+    DOCTEST_CHECK_EQ(engine.getInputIndex(), 0);
+}
+
+DOCTEST_TEST_CASE("SimonEngine - Entrada incorreta e game over") {
+    SequenceGenerator generator;
+    Player player("Bot", 2);
+    SimonEngine engine(generator, player);
+    engine.startGame();
+
+    const auto& wrong = engine.step(wrongSymbol(generator, 0));
+    DOCTEST_CHECK(wrong[0].type == EngineEventType::INPUT_WRONG);
+    DOCTEST_CHECK_EQ(wrong[0].expected, generator.getElementAt(0));
+    DOCTEST_CHECK(hasEvent(wrong, EngineEventType::LIFE_LOST));
+    DOCTEST_CHECK(hasEvent(wrong, EngineEventType::ROUND_RESTARTED));
+    DOCTEST_CHECK_EQ(player.getLives(), 1);
+    DOCTEST_CHECK_EQ(generator.getSequenceLength(), 2); // Mesma sequência
+
+    const auto& fatal = engine.step(wrongSymbol(generator, 0));
+    DOCTEST_CHECK(hasEvent(fatal, EngineEventType::GAME_OVER));
+    DOCTEST_CHECK(engine.isFinished());
+    DOCTEST_CHECK(!engine.isWaitingInput());
+
+    // Entradas após o fim do jogo são ignoradas
+    DOCTEST_CHECK(engine.step("A").empty());
+}
+
+DOCTEST_TEST_CASE("SimonEngine - Revelar sequência") {
+    SequenceGenerator generator;
+    Player player("Bot", 1);
+    SimonEngine engine(generator, player);
+    engine.startGame();
+
+    const auto& events = engine.revealSequence();
+    DOCTEST_CHECK(hasEvent(events, EngineEventType::LIFE_LOST));
+    DOCTEST_CHECK(hasEvent(events, EngineEventType::GAME_OVER));
+    DOCTEST_CHECK(engine.getPhase() == EnginePhase::GAME_OVER);
+}
+
+DOCTEST_TEST_CASE("SimonEngine - Jogo completo sem pausas") {
+    SequenceGenerator generator;
+    Player player("Bot", 3);
+    SimonEngine engine(generator, player);
+    engine.startGame();
+
+    int rounds = 0;
+    while (engine.isWaitingInput() && rounds < 100) {
+        playRound(engine, generator);
+        rounds++;
+    }
+
+    DOCTEST_CHECK(engine.getPhase() == EnginePhase::GAME_COMPLETE);
+    DOCTEST_CHECK(generator.isAtMaxLength());
+    DOCTEST_CHECK(player.isAlive());
+}
+
+DOCTEST_TEST_CASE("SimonEngine - Abandonar jogo") {
+    SequenceGenerator generator;
+    Player player("Bot", 3);
+    SimonEngine engine(generator, player);
+    engine.startGame();
+
+    engine.abandonGame();
+    DOCTEST_CHECK(engine.getPhase() == EnginePhase::IDLE);
+    DOCTEST_CHECK(engine.step(generator.getElementAt(0)).empty());
+}
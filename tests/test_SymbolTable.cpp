@@ -0,0 +1,59 @@
+/**
+ * @file test_SymbolTable.cpp
+ * @brief Testes unitários para a classe SymbolTable
+ * @author Projeto Acadêmico C++11
+ * @date 2025
+ * @version 1.0
+ */
+
+#include "doctest.h"
+#include "SymbolTable.h"
+
+DOCTEST_TEST_CASE("SymbolTable - Busca de símbolos") {
+    SymbolTable table({"A", "B", "C", "D", "SAIR", "REVELAR"});
+
+    DOCTEST_CHECK_EQ(table.size(), 6);
+    DOCTEST_CHECK_EQ(table.find("A"), 0);
+    DOCTEST_CHECK_EQ(table.find('D'), 3);
+    DOCTEST_CHECK_EQ(table.find("SAIR"), 4);
+    DOCTEST_CHECK_EQ(table.find("REVELAR"), 5);
+    DOCTEST_CHECK_EQ(table.name(5), "REVELAR");
+
+    DOCTEST_CHECK_EQ(table.find("a"), SymbolTable::NOT_FOUND);
+    DOCTEST_CHECK_EQ(table.find("E"), SymbolTable::NOT_FOUND);
+    DOCTEST_CHECK_EQ(table.find(""), SymbolTable::NOT_FOUND);
+    DOCTEST_CHECK_EQ(table.find("SAIRR"), SymbolTable::NOT_FOUND);
+    DOCTEST_CHECK(table.contains("C"));
+}
+
+DOCTEST_TEST_CASE("SymbolTable - Sem distinção de maiúsculas") {
+    SymbolTable table({"A", "B", "SAIR"}, true);
+
+    DOCTEST_CHECK_EQ(table.find("a"), 0);
+    DOCTEST_CHECK_EQ(table.find('b'), 1);
+    DOCTEST_CHECK_EQ(table.find("Sair"), 2);
+    DOCTEST_CHECK_EQ(table.name(table.find("sair")), "SAIR");
+
+    SymbolTable folded(true);
+    DOCTEST_CHECK(!folded.assign({"a", "A"}));
+}
+
+DOCTEST_TEST_CASE("SymbolTable - Validação do conjunto") {
+    SymbolTable table({"X", "Y"});
+
+    DOCTEST_CHECK(!table.assign({"A", "B", "A"}));
+    DOCTEST_CHECK(!table.assign({"AB", "C", "AB"}));
+    DOCTEST_CHECK_EQ(table.find("X"), 0); // Falha não altera a tabela
+
+    DOCTEST_CHECK(table.assign({"Z", "LONGO"}));
+    DOCTEST_CHECK_EQ(table.find("X"), SymbolTable::NOT_FOUND);
+    DOCTEST_CHECK_EQ(table.find("LONGO"), 1);
+
+    std::vector<std::string> tooMany;
+    for (int i = 0; i < 256; ++i) {
+        tooMany.push_back("S" + std::to_string(i));
+    }
+    DOCTEST_CHECK(!SymbolTable::isValidSymbolSet(tooMany));
+    DOCTEST_CHECK(SymbolTable::isValidSymbolSet({"A", "B"}));
+    DOCTEST_CHECK_THROWS(SymbolTable({"A", "A"}));
+}